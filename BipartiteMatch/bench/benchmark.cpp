@@ -0,0 +1,216 @@
+/**
+ * benchmark.cpp
+ * Timing of the solvers on generated instances.
+ * Also serves as the training run for the
+ * profile-guided build (make pgo).
+ *
+ * usage: benchmark [size] [seed]
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bottleneck.h"
+#include "costscaling.h"
+#include "externalmatch.h"
+#include "hungarian.h"
+#include "maxmatch.h"
+#include "parallelhungarian.h"
+#include "reorder.h"
+#include "index.h"
+
+std::vector<int> random_weights(const int &, const int &, const unsigned &);
+std::vector<int> random_graph(const int &, const int &, const int &, const unsigned &);
+void bench_hungarian(const int &, const unsigned &);
+void bench_maxmatch(const int &, const unsigned &);
+void bench_costscaling(const int &, const unsigned &);
+void bench_bottleneck(const int &, const unsigned &);
+void bench_parallel(const int &, const unsigned &);
+std::vector<int> shuffled_band_graph(const int &, const int &, const unsigned &);
+void bench_reorder(const int &, const unsigned &);
+void bench_external(const int &, const unsigned &);
+void report(const char *, const int &, const std::chrono::steady_clock::time_point &);
+
+int main(int argc, char **argv) {
+    int size = argc > 1 ? std::atoi(argv[1]) : 200;
+    unsigned seed = argc > 2 ? std::atoi(argv[2]) : 1;
+
+    bench_hungarian(size / 2, seed);
+    bench_costscaling(size / 2, seed);
+    bench_bottleneck(size, seed);
+    bench_parallel(size * 4, seed);
+    bench_maxmatch(size * 4, seed);
+    bench_reorder(size * 4, seed);
+    bench_external(size * 1000, seed);
+    return 0;
+}
+
+/**
+ * dense len x len weight matrix with entries uniform in [0, max_weight]
+ */
+std::vector<int> random_weights(const int &len, const int &max_weight, const unsigned &seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, max_weight);
+    std::vector<int> weights(static_cast<std::size_t>(len) * len);
+
+    for (int &w : weights) {
+        w = dist(gen);
+    }
+    return weights;
+}
+
+/**
+ * rows x cols adjacency matrix with about degree edges per row
+ */
+std::vector<int> random_graph(const int &rows, const int &cols, const int &degree, 
+        const unsigned &seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, cols - 1);
+    std::vector<int> graph(static_cast<std::size_t>(rows) * cols, 0);
+    Index index(cols);
+
+    for (int i = 0; i < rows; ++i) {
+        for (int k = 0; k < degree; ++k) {
+            graph[index.index(i, dist(gen))] = 1;
+        }
+    }
+    return graph;
+}
+
+void bench_hungarian(const int &len, const unsigned &seed) {
+    std::vector<int> weights = random_weights(len, 1000, seed);
+    auto start = std::chrono::steady_clock::now();
+    Hungarian hung(weights.data(), len);
+
+    hung.init();
+    std::cout << "total weight " << hung.get_match_total() << std::endl;
+    report("Hungarian", len, start);
+}
+
+void bench_maxmatch(const int &len, const unsigned &seed) {
+    std::vector<int> graph = random_graph(len, len, 3, seed);
+    auto start = std::chrono::steady_clock::now();
+    MaxMatch mm(graph.data(), len, len);
+
+    mm.init();
+    std::cout << "matches " << mm.matches() << std::endl;
+    report("MaxMatch", len, start);
+}
+
+void bench_costscaling(const int &len, const unsigned &seed) {
+    std::vector<int> weights = random_weights(len, 1000, seed);
+    auto start = std::chrono::steady_clock::now();
+    CostScaling cs(weights.data(), len);
+
+    cs.init();
+    std::cout << "total weight " << cs.get_match_total() << std::endl;
+    report("CostScaling", len, start);
+}
+
+void bench_bottleneck(const int &len, const unsigned &seed) {
+    std::vector<int> weights = random_weights(len, 1000, seed);
+    auto start = std::chrono::steady_clock::now();
+    Bottleneck bot(weights.data(), len);
+
+    bot.init();
+    std::cout << "bottleneck " << bot.threshold() << " after " << bot.probes() << " probes" << std::endl;
+    report("Bottleneck", len, start);
+}
+
+void bench_parallel(const int &len, const unsigned &seed) {
+    std::vector<int> weights = random_weights(len, 1000, seed);
+    auto start = std::chrono::steady_clock::now();
+    ParallelHungarian hung(weights.data(), len);
+
+    hung.init();
+    std::cout << "total weight " << hung.get_match_total() << " with " << hung.threads() 
+        << " threads" << std::endl;
+    report("ParallelHungarian", len, start);
+}
+
+/**
+ * len x len graph with edges near the diagonal, like a graph
+ * with locality, whose vertices then get random ids
+ */
+std::vector<int> shuffled_band_graph(const int &len, const int &width, const unsigned &seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(-width, width);
+    std::vector<int> idX(len), idY(len), graph(len * len, 0);
+    Index index(len);
+
+    for (int i = 0; i < len; ++i) {
+        idX[i] = i;
+        idY[i] = i;
+    }
+    std::shuffle(idX.begin(), idX.end(), gen);
+    std::shuffle(idY.begin(), idY.end(), gen);
+    for (int i = 0; i < len; ++i) {
+        for (int k = 0; k < 3; ++k) {
+            int j = std::min(std::max(i + dist(gen), 0), len - 1);
+            graph[index.index(idX[i], idY[j])] = 1;
+        }
+    }
+    return graph;
+}
+
+void bench_reorder(const int &len, const unsigned &seed) {
+    std::vector<int> graph = shuffled_band_graph(len, 8, seed);
+    const Reorder::Order orders[] = { Reorder::ORDER_NONE, Reorder::ORDER_DEGREE, 
+        Reorder::ORDER_RCM };
+    const char *names[] = { "none", "degree", "RCM" };
+
+    for (int k = 0; k < 3; ++k) {
+        std::string name = std::string("Reorder ") + names[k];
+        auto start = std::chrono::steady_clock::now();
+        Reorder reorder(graph.data(), len, len, orders[k]);
+        report((name + " setup").c_str(), len, start);
+        start = std::chrono::steady_clock::now();
+        reorder.init();
+        std::cout << "matches " << reorder.matches() << std::endl;
+        report((name + " solve").c_str(), len, start);
+    }
+}
+
+/**
+ * len x len graph with 3 random edges per row, matched from a
+ * file in /tmp. Timing includes writing the file.
+ */
+void bench_external(const int &len, const unsigned &seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, len - 1);
+    std::vector<int> x, y;
+    const char *path = "/tmp/benchmark_externalmatch";
+
+    for (int i = 0; i < len; ++i) {
+        for (int k = 0; k < 3; ++k) {
+            x.push_back(i);
+            y.push_back(dist(gen));
+        }
+    }
+    auto start = std::chrono::steady_clock::now();
+    ExternalMatch::write(path, x.data(), y.data(), x.size(), len, len);
+    ExternalMatch em(path);
+
+    em.init();
+    std::cout << "matches " << em.matches() << " in " << em.phases() << " phases" << std::endl;
+    report("ExternalMatch", len, start);
+    std::remove(path);
+}
+
+void report(const char *name, const int &len, const std::chrono::steady_clock::time_point &start) {
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << name << " n=" << len << ": " << elapsed.count() << " ms" << std::endl;
+}
@@ -0,0 +1,149 @@
+/**
+ * loadgen.cpp
+ * Load generator for solverd. Client threads submit random
+ * problems through the daemon's ShmRing as fast as results
+ * come back and report throughput and latency percentiles.
+ *
+ * usage: loadgen name [requests] [len] [clients] [h|m] [stop]
+ * h sends len x len Hungarian weights, m sends len x len
+ * MaxMatch adjacency with about 3 edges per row.
+ * A nonzero stop shuts the daemon down afterwards.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "shmring.h"
+
+void client(ShmRing &, const int &, const int &, const int &, const unsigned &, std::vector<double> &);
+void stop_server(ShmRing &);
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " name [requests] [len] [clients] [h|m] [stop]" << std::endl;
+        return 1;
+    }
+    int requests = argc > 2 ? std::atoi(argv[2]) : 10000,
+        len = argc > 3 ? std::atoi(argv[3]) : 32,
+        clients = argc > 4 ? std::max(std::atoi(argv[4]), 1) : 4,
+        kind = argc > 5 && argv[5][0] == 'm' ? ShmRing::KIND_MAXMATCH : ShmRing::KIND_HUNGARIAN;
+    bool stop = argc > 6 && std::atoi(argv[6]) != 0;
+
+    try {
+        ShmRing ring(argv[1]);
+        std::vector<std::vector<double> > latencies(clients);
+        std::vector<std::thread> threads;
+        std::vector<double> all;
+
+        if (len > ring.max_len()) {
+            std::cerr << "loadgen: len " << len << " exceeds ring max_len " << ring.max_len() << std::endl;
+            return 1;
+        }
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < clients; ++i) {
+            threads.emplace_back(client, std::ref(ring), kind, len, requests / clients, 
+                    static_cast<unsigned>(i + 1), std::ref(latencies[i]));
+        }
+        for (std::thread &t : threads) {
+            t.join();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        for (const std::vector<double> &l : latencies) {
+            all.insert(all.end(), l.begin(), l.end());
+        }
+        std::sort(all.begin(), all.end());
+        if (!all.empty()) {
+            std::cout << all.size() << " requests of " << len << " x " << len << " in " 
+                << elapsed.count() << " s: " << all.size() / elapsed.count() << " req/s" << std::endl;
+            std::cout << "latency us p50 " << all[all.size() / 2] << ", p99 " 
+                << all[all.size() * 99 / 100] << ", max " << all.back() << std::endl;
+        }
+        if (stop) stop_server(ring);
+    } catch (const std::exception &e) {
+        std::cerr << "loadgen: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * problems are generated up front so that the latencies
+ * measure the round trip through the daemon
+ */
+void client(ShmRing &ring, const int &kind, const int &len, const int &requests, 
+        const unsigned &seed, std::vector<double> &latencies) {
+    const int pool = 16;
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> weight(0, 1000),
+        column(0, len - 1);
+    std::vector<std::vector<int> > problems(pool, std::vector<int>(len * len, 0));
+    long long checksum = 0;
+
+    for (std::vector<int> &p : problems) {
+        if (kind == ShmRing::KIND_HUNGARIAN) {
+            for (int &w : p) {
+                w = weight(gen);
+            }
+        } else {
+            for (int i = 0; i < len; ++i) {
+                for (int k = 0; k < 3; ++k) {
+                    p[i * len + column(gen)] = 1;
+                }
+            }
+        }
+    }
+    latencies.reserve(requests);
+    for (int r = 0; r < requests; ++r) {
+        const std::vector<int> &p = problems[r % pool];
+        auto start = std::chrono::steady_clock::now();
+        unsigned long long ticket;
+
+        if (!ring.acquire(ticket)) {
+            std::cerr << "loadgen: solver ring stopped" << std::endl;
+            return;
+        }
+        ShmRing::Slot &slot = ring.slot(ticket);
+
+        slot.kind = kind;
+        slot.rows = len;
+        slot.cols = len;
+        std::memcpy(ring.matrix(ticket), p.data(), p.size() * sizeof(int));
+        ring.submit(ticket);
+        if (!ring.wait(ticket)) {
+            std::cerr << "loadgen: solver ring stopped" << std::endl;
+            return;
+        }
+        if (slot.status == ShmRing::STATUS_STOPPED) {
+            std::cerr << "loadgen: solver ring stopped" << std::endl;
+            ring.release(ticket);
+            return;
+        }
+        checksum += slot.total;
+        ring.release(ticket);
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        latencies.push_back(elapsed.count());
+    }
+    if (checksum < 0) std::cerr << "loadgen: negative total" << std::endl;
+}
+
+void stop_server(ShmRing &ring) {
+    unsigned long long ticket;
+
+    if (!ring.acquire(ticket)) return;
+    ring.slot(ticket).kind = ShmRing::KIND_SHUTDOWN;
+    ring.submit(ticket);
+    if (ring.wait(ticket)) ring.release(ticket);
+}
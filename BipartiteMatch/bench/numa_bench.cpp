@@ -0,0 +1,79 @@
+/**
+ * numa_bench.cpp
+ * Bandwidth of row-block scans over a large matrix placed
+ * by first touch per node, interleaved over the nodes, or
+ * all on the node of the allocating thread. Scanning
+ * threads are pinned so that thread t reads the row block
+ * first-touch placement puts on its own node.
+ *
+ * usage: numa_bench [len] [threads] [passes]
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "numaalloc.h"
+
+void bench(const char *, const NumaAlloc::Placement &, const std::size_t &, const int &, const int &);
+
+int main(int argc, char **argv) {
+    std::size_t len = argc > 1 ? std::atol(argv[1]) : 8192;
+    int threads = argc > 2 ? std::atoi(argv[2]) : std::thread::hardware_concurrency(),
+        passes = argc > 3 ? std::atoi(argv[3]) : 10;
+    const NumaAlloc &numa = NumaAlloc::system();
+
+    threads = std::max(threads, 1);
+    std::cout << numa.nodes() << " nodes, " << threads << " threads, " << len << " x " << len 
+        << " matrix" << std::endl;
+    bench("first touch", NumaAlloc::PLACEMENT_FIRST_TOUCH, len, threads, passes);
+    bench("interleave", NumaAlloc::PLACEMENT_INTERLEAVE, len, threads, passes);
+    bench("one node", NumaAlloc::PLACEMENT_LOCAL, len, threads, passes);
+    return 0;
+}
+
+void bench(const char *name, const NumaAlloc::Placement &placement, const std::size_t &len, 
+        const int &threads, const int &passes) {
+    const NumaAlloc &numa = NumaAlloc::system();
+    std::vector<int> src(len * len, 1);
+    int *matrix = numa.alloc(len, len, src.data(), placement);
+    std::vector<long long> sums(threads, 0);
+    std::vector<std::thread> workers;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            NumaAlloc::pin(numa.cpu(t, threads));
+            std::size_t first = len * t / threads,
+                last = len * (t + 1) / threads;
+            long long sum = 0;
+            for (int p = 0; p < passes; ++p) {
+                for (const int *cell = matrix + first * len; cell < matrix + last * len; ++cell) {
+                    sum += *cell;
+                }
+            }
+            sums[t] = sum;
+        });
+    }
+    for (std::thread &w : workers) {
+        w.join();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    long long total = 0;
+    for (long long s : sums) {
+        total += s;
+    }
+    double gb = static_cast<double>(len) * len * sizeof(int) * passes / 1e9;
+    std::cout << name << ": " << gb / elapsed.count() << " GB/s" 
+        << (total == static_cast<long long>(len * len * passes) ? "" : " (bad checksum)") << std::endl;
+    NumaAlloc::release(matrix, len, len);
+}
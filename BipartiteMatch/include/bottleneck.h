@@ -0,0 +1,63 @@
+/**
+ * bottleneck.h
+ * Bottleneck class finds a perfect matching of a complete
+ * bipartite graph that minimizes the largest weight used,
+ * for the same len x len weights as Hungarian.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#ifndef BOTTLENECK_H
+#define BOTTLENECK_H
+
+#include <cstddef>
+#include <vector>
+
+#include "index.h"
+#include "maxmatch.h"
+
+class Bottleneck {
+private:
+    const int len_;
+    const Index index_;
+    int *weights_;
+    // edge offsets sorted by weight
+    std::size_t *order_;
+    int threshold_;
+    // threshold values tried
+    int probes_;
+    MaxMatch matcher_;
+    // edges order_[0] .. order_[added_ - 1] are in matcher_
+    std::size_t added_;
+    // maximum matching at the largest threshold known to fail
+    std::vector<int> saved_;
+
+public:
+    Bottleneck(const int *weights, const int &len);
+    ~Bottleneck();
+
+    // run the algorithm to get the matching
+    void init();
+    // largest weight in the matching
+    int threshold() const;
+    int probes() const;
+    int matchX(const int &) const;
+    int matchY(const int &) const;
+    int length() const;
+
+private:
+    // number of edges of weight at most w
+    std::size_t prefix(const int &w) const;
+    /**
+     * match with the edges of weight at most w, starting from
+     * saved_. Return true if the matching is perfect, otherwise
+     * save it in saved_
+     */
+    bool probe(const int &w);
+};
+
+#endif
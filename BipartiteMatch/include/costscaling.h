@@ -0,0 +1,100 @@
+/**
+ * costscaling.h
+ * CostScaling class finds a maximum weight matching in a
+ * bipartite graph by epsilon scaling of an auction, which
+ * uses the size of the weights rather than ignoring them.
+ * There are no global price updates, so the bound is
+ * O(n m log(nC)) for C the largest weight, not the
+ * O(sqrt(n) m log(nC)) of Goldberg-Kennedy.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#ifndef COSTSCALING_H
+#define COSTSCALING_H
+
+#include <cstddef>
+
+class CostScaling {
+private:
+    // factor by which epsilon shrinks in each scaling phase
+    static const int ALPHA = 8;
+    // partition sizes of the input graph
+    const int sizeX_;
+    const int sizeY_;
+    /**
+     * vertices per side of the assignment problem solved.
+     * Equals sizeX_ for dense input. Sparse input is padded
+     * with a copy of each partition on the other side so that
+     * a perfect assignment always exists.
+     */
+    const int n_;
+    /**
+     * weights are multiplied by n_ + 1, so that an assignment
+     * which is epsilon-optimal for epsilon = 1 is optimal
+     */
+    const long long scale_;
+    /**
+     * edges of X vertex x are first_[x] .. first_[x + 1] - 1.
+     * 64-bit, since a dense graph above about 46k per side has
+     * more edges than int can count.
+     */
+    std::size_t *first_;
+    // Y vertex of each edge
+    int *head_;
+    int *weights_;
+    long long *prices_;
+    // edge matched to each X vertex, -1 if none
+    long long *match_edge_;
+    // X vertex matched to each Y vertex, -1 if none
+    int *match_by_Y_;
+    // stack of X vertices without a match during refine()
+    int *active_;
+
+public:
+    /**
+     * dense len x len weight matrix, as for Hungarian
+     */
+    CostScaling(const int *weights, const int &len);
+    /**
+     * sparse graph given as edges (x[k], y[k]) with weight weights[k].
+     * Absent edges are never matched, and edges with negative weight
+     * are left unmatched rather than used.
+     */
+    CostScaling(const int *x, const int *y, const int *weights, const std::size_t &edges, 
+            const int &sizeX, const int &sizeY);
+    ~CostScaling();
+    CostScaling(const CostScaling &) = delete;
+    CostScaling &operator=(const CostScaling &) = delete;
+
+    // run the algorithm to get the matching
+    void init();
+    long long get_match_total() const;
+    /**
+     * get the Y element matching a given X element.
+     * return -1 if no element matches
+     */
+    int matchX(const int &) const;
+    /**
+     * get the X element matching a given Y element
+     * return -1 if no element matches
+     */
+    int matchY(const int &) const;
+    int sizeX() const;
+    int sizeY() const;
+
+private:
+    void allocate(const std::size_t &edges);
+    /**
+     * find an epsilon-optimal assignment starting from the
+     * current prices, which are raised as X vertices bid for
+     * their best Y vertex
+     */
+    void refine(const long long &epsilon);
+};
+
+#endif
@@ -0,0 +1,120 @@
+/**
+ * externalmatch.h
+ * ExternalMatch class finds a maximum matching in a sparse
+ * bipartite graph whose adjacency lists are too large for RAM.
+ * The adjacency lives in a file mapped read-only, while the
+ * vertex state (offsets, matching, BFS layers) stays in memory.
+ * The matching is found by Hopcroft-Karp, and the adjacency of
+ * each BFS layer is requested from disk ahead of its use.
+ *
+ * File layout, in host byte order:
+ *     header        magic, rows, cols, edges
+ *     offsets       uint64 x (rows + 1), edges of x are
+ *                   offsets[x] .. offsets[x + 1] - 1
+ *     adjacency     int32 x edges, Y vertex of each edge
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#ifndef EXTERNALMATCH_H
+#define EXTERNALMATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class ExternalMatch {
+public:
+    struct Header {
+        std::uint64_t magic;
+        std::uint64_t rows;
+        std::uint64_t cols;
+        std::uint64_t edges;
+    };
+    static const std::uint64_t MAGIC = 0x3152534342504942ULL;
+    // bytes of adjacency requested ahead of the current BFS vertex
+    static const std::size_t PREFETCH_BYTES = 8 << 20;
+
+private:
+    // sizes, read from the file header
+    int rows_;
+    int cols_;
+    std::size_t edges_;
+    // mapping of the whole file
+    void *map_;
+    std::size_t map_bytes_;
+    // Y vertex of each edge, inside map_
+    const std::int32_t *adj_;
+    // edges of X vertex x are first_[x] .. first_[x + 1] - 1
+    std::uint64_t *first_;
+    // next edge to try from each X vertex in the current phase
+    std::uint64_t *cursor_;
+    // BFS layer of each X vertex, -1 if not reached
+    int *dist_;
+    // X vertices in BFS order, one layer after another
+    int *queue_;
+    int *matchX_;
+    int *matchY_;
+    // DFS path of X vertices
+    std::vector<int> stack_;
+    // layer from which a free Y vertex was reached
+    int last_layer_;
+    int matches_;
+    int phases_;
+
+public:
+    /**
+     * map a graph file written by write().
+     * Throws std::runtime_error if the header, sizes or offsets
+     * are not those of a valid graph.
+     */
+    explicit ExternalMatch(const char *path);
+    ~ExternalMatch();
+    ExternalMatch(const ExternalMatch &) = delete;
+    ExternalMatch &operator=(const ExternalMatch &) = delete;
+
+    /**
+     * write the graph with edges (x[k], y[k]) to the given path
+     * in the layout above. The output is filled through a shared
+     * mapping, so it may be larger than RAM.
+     */
+    static void write(const char *path, const int *x, const int *y, const std::size_t &edges,
+            const int &rows, const int &cols);
+
+    /**
+     * run the algorithm to get the matching.
+     * Throws std::runtime_error if an edge has a Y vertex out of
+     * range, which is checked in the first pass over the file.
+     */
+    void init();
+    /**
+     * get the Y element matching a given X element.
+     * return -1 if no element matches
+     */
+    int match_X(const int &) const;
+    int match_Y(const int &) const;
+    int matches() const;
+    // augmenting phases of the last init()
+    int phases() const;
+    std::size_t edges() const;
+    int sizeX() const;
+    int sizeY() const;
+
+private:
+    // build the BFS layers from the free X vertices
+    bool bfs();
+    // augment along a shortest path from a free X vertex, if any
+    bool dfs(const int &start);
+    /**
+     * ask the kernel to read the adjacency of queue_[from], ...
+     * until PREFETCH_BYTES are covered or to is reached.
+     * return the first queue position not covered
+     */
+    int prefetch(const int &from, const int &to) const;
+};
+
+#endif
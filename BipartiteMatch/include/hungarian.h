@@ -14,16 +14,23 @@
 #ifndef HUNGARIAN_H
 #define HUNGARIAN_H
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 
 #include "maxmatch.h"
 #include "index.h"
+#include "numaalloc.h"
 
 class Hungarian {
 private:
     // the number of rows (or cols, since matrix is square)
-    const int len_;
-    const int len_sq_;
+    int len_;
+    std::size_t len_sq_;
+    // side of the matrices and length of the arrays allocated
+    int capacity_;
+    // placement of weights_ and equality_graph_
+    NumaAlloc::Placement placement_;
     /**
      * the graph is bipartite, but edges may have weight 0
      * to deal with the case where the sets to match have different
@@ -48,8 +55,38 @@ private:
     MaxMatch matcher_;
 
 public:
-    Hungarian(const int *weights, const int &len);
+    /**
+     * the solver runs on the calling thread, so by default its
+     * matrices are placed on that thread's node
+     */
+    Hungarian(const int *weights, const int &len, 
+            const NumaAlloc::Placement &placement = NumaAlloc::PLACEMENT_LOCAL);
+    /**
+     * start from the given vertex labels, which must be feasible:
+     * labelsX[x] + labelsY[y] >= weight(x, y) for all x, y
+     */
+    Hungarian(const int *weights, const int &len, const int *labelsX, const int *labelsY, 
+            const NumaAlloc::Placement &placement = NumaAlloc::PLACEMENT_LOCAL);
     ~Hungarian();
+    /**
+     * the moved-from solver is left empty, of length 0, by
+     * construction and by assignment alike
+     */
+    Hungarian(Hungarian &&) noexcept;
+    Hungarian &operator=(Hungarian &&) noexcept;
+    Hungarian(const Hungarian &) = delete;
+    Hungarian &operator=(const Hungarian &) = delete;
+
+    /**
+     * start over on a new problem, as the constructors do.
+     * Storage is only reallocated if len is larger than any
+     * before, so a warm solver can be reused without faulting
+     * in pages.
+     */
+    void reassign(const int *weights, const int &len, const int *labelsX = nullptr, 
+            const int *labelsY = nullptr);
+    // cells of weight storage allocated, as MaxMatch::capacity()
+    std::size_t capacity() const;
 
     int get_match_total();
     int matchX(const int &) const;
@@ -57,8 +94,28 @@ public:
     int length() const;
     int weight(const int &, const int &) const;
     void init();
+    /**
+     * run the algorithm until the matching is perfect, the deadline
+     * has passed or *cancel is true, checked between relabel phases
+     * and between the matcher's augmenting passes, so it can be
+     * overrun by one O(len^2) step. The constructors and reassign()
+     * take no deadline: they build the equality graph and match it
+     * in full, so large problems should be set up ahead of time.
+     * Return true if the matching is perfect, hence optimal.
+     * Otherwise matchX() and matchY() give a partial matching
+     * on feasible edges and get_dual_bound() an upper bound on
+     * the optimal total.
+     */
+    bool init(const std::chrono::steady_clock::time_point &deadline, 
+            const std::atomic<bool> *cancel = nullptr);
+    // sum of vertex labels, an upper bound on get_match_total()
+    int get_dual_bound() const;
+    // vertex labels, the dual solution
+    int labelX(const int &) const;
+    int labelY(const int &) const;
 
 private:
+    void swap(Hungarian &) noexcept;
     void improve_equality_graph();
     int get_free_vertex() const;
     void update_equality_graph();
@@ -1 +0,0 @@
-../../../Index/include/index.h
\ No newline at end of file
@@ -0,0 +1,43 @@
+/**
+ * index.h
+ * Index class maps (row, column) pairs to offsets in a
+ * row-major matrix stored as a flat array, and back.
+ * Header-only so that the compiler can inline the
+ * multiply-add in the solvers' innermost loops.
+ * Offsets are 64-bit, since rows * cols overflows int
+ * above about 46k per side.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#ifndef INDEX_H
+#define INDEX_H
+
+#include <cstddef>
+
+class Index {
+private:
+    // row length of the matrix
+    std::size_t cols_;
+public:
+    explicit Index(const int &cols) : cols_(cols) {}
+
+    // offset of the given row and column
+    inline std::size_t index(const int &row, const int &col) const {
+        return static_cast<std::size_t>(row) * cols_ + col;
+    }
+    // row of the given offset
+    inline int row(const std::size_t &i) const {
+        return i / cols_;
+    }
+    // column of the given offset
+    inline int col(const std::size_t &i) const {
+        return i % cols_;
+    }
+};
+
+#endif
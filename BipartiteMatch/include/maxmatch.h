@@ -12,22 +12,81 @@
 #ifndef MAXMATCH_H
 #define MAXMATCH_H
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
 #include "index.h"
+#include "numaalloc.h"
 
 class MaxMatch {
 private:
-    const int rows_;
-    const int cols_;
-    const Index index_;
+    int rows_;
+    int cols_;
+    Index index_;
+    // dimensions graph_ was allocated with, at least rows_ x cols_
+    std::size_t graph_rows_;
+    std::size_t graph_cols_;
+    // allocated lengths of the X and Y arrays
+    int capX_;
+    int capY_;
+    // placement of graph_
+    NumaAlloc::Placement placement_;
     int *graph_,
         *match_by_X_,
         *match_by_Y_,
-        *childX_;
+        /**
+         * -1 for X vertices not visited by the current search,
+         * -2 for visited vertices from which no augmenting path
+         * exists, otherwise the next Y vertex on the search path.
+         * After init() the marks of the final (failed) search
+         * are the X vertices reachable from free X vertices.
+         */
+        *childX_,
+        // 1 for Y vertices reachable from free Y vertices
+        *visitY_;
 public:
-    MaxMatch(const int *, const int &, const int &);
+    /**
+     * Dulmage-Mendelsohn classes of a vertex.
+     * DM_EVEN vertices are left unmatched by some maximum matching,
+     * DM_ODD vertices are their neighbors and DM_PERFECT vertices
+     * are perfectly matched among themselves.
+     * DM_ODD and DM_PERFECT vertices are matched in every maximum
+     * matching.
+     */
+    enum DMClass { DM_EVEN, DM_ODD, DM_PERFECT };
+    /**
+     * the search runs on the calling thread, so by default the
+     * graph is placed on its node
+     */
+    MaxMatch(const int *, const int &, const int &, 
+            const NumaAlloc::Placement &placement = NumaAlloc::PLACEMENT_LOCAL);
+    /**
+     * graph without edges, to be filled with add_graph_edge().
+     * Saves building a zero matrix just to copy it.
+     */
+    MaxMatch(const int &, const int &, 
+            const NumaAlloc::Placement &placement = NumaAlloc::PLACEMENT_LOCAL);
     ~MaxMatch();
+    /**
+     * the moved-from solver is left empty, 0 x 0, by
+     * construction and by assignment alike
+     */
+    MaxMatch(MaxMatch &&) noexcept;
+    MaxMatch &operator=(MaxMatch &&) noexcept;
+    MaxMatch(const MaxMatch &) = delete;
+    MaxMatch &operator=(const MaxMatch &) = delete;
     // run the algorithm to get the matching
     void init();
+    /**
+     * as init(), but stop before another augmenting pass, each
+     * O(rows x cols), once the deadline has passed or *cancel is
+     * true. At least one pass runs. Return true if the matching is
+     * maximum; otherwise it is a partial matching, which a later
+     * init() extends, and cover and decomposition marks are invalid.
+     */
+    bool init(const std::chrono::steady_clock::time_point &deadline, 
+            const std::atomic<bool> *cancel = nullptr);
     /**
      * get the Y element matching a given X element.
      * return -1 if no element matches
@@ -49,27 +108,72 @@ public:
      * Also resets match_by_row_ and match_by_col_ to 0s
      */
     void set(const int *);
+    /**
+     * change the number of rows and columns. Storage is only
+     * reallocated if the new graph is larger than any before,
+     * so a warm solver can be reused without faulting in pages.
+     * The graph is undefined until set() is called.
+     */
+    void resize(const int &, const int &);
+    // resize() and set()
+    void reassign(const int *, const int &, const int &);
+    // cells of graph storage allocated
+    std::size_t capacity() const;
     /**
      * Does not reset matchings to avoid unnecessary repetition
      */
     void add_graph_edge(const int &, const int &);
     void delete_graph_edge(const int &, const int &);
     bool has_graph_edge(const int &, const int &);
+    /**
+     * as set(), but keep the current matching, whose edges must
+     * all be in the new graph
+     */
+    void set_graph(const int *);
+    /**
+     * replace the matching, for init() to extend: x is matched
+     * to matchX[x], or unmatched if it is -1. Each pair must be
+     * an edge of the graph.
+     */
+    void set_match(const int *matchX);
     int sizeX() const;
     int sizeY() const;
     void reset();
+    /**
+     * membership in the König minimum vertex cover.
+     * Read from the marks of the final search, so only valid
+     * after init() and before the graph or matching change.
+     */
+    bool cover_X(const int &) const;
+    bool cover_Y(const int &) const;
+    /**
+     * search for alternating paths from the free Y vertices.
+     * Must be called after init() before dm_X() or dm_Y().
+     */
+    void decompose();
+    DMClass dm_X(const int &) const;
+    DMClass dm_Y(const int &) const;
 private:
+    void swap(MaxMatch &) noexcept;
     void reset_matches();
     void reset_childX();
+    void reset_visitY();
     /**
-     * Return the start of an augmenting path, if there
-     * is one. Otherwise, return -1.
+     * augment from each free X vertex in turn, keeping the
+     * visited vertices of earlier searches in the same pass,
+     * so the paths found are vertex-disjoint.
+     * Return the number of augmenting paths found.
      */
     int dfs();
     /**
      * recursive search starting at a given X vertex.
      */
     bool dfs_visit(const int &);
+    /**
+     * recursive search from a given Y vertex, alternating
+     * unmatched edges to X and matched edges back to Y.
+     */
+    void dfs_visit_Y(const int &);
     void augment_match(int);
 };
 #endif
@@ -0,0 +1,74 @@
+/**
+ * numaalloc.h
+ * NumaAlloc class places large matrices across the NUMA
+ * nodes of the host and pins threads to nodes or cores.
+ * Topology is read from /sys/devices/system/node; hosts
+ * without it are treated as a single node.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#ifndef NUMAALLOC_H
+#define NUMAALLOC_H
+
+#include <cstddef>
+#include <vector>
+
+class NumaAlloc {
+public:
+    enum Placement {
+        // row block k is first written by a thread on node k
+        PLACEMENT_FIRST_TOUCH,
+        // pages spread round robin over all nodes
+        PLACEMENT_INTERLEAVE,
+        // everything written by the calling thread
+        PLACEMENT_LOCAL
+    };
+    /**
+     * matrices smaller than this come from new[] and are
+     * written by the calling thread
+     */
+    static const std::size_t MIN_PLACED_BYTES = 1 << 22;
+
+private:
+    // kernel ids of the nodes with cpus
+    std::vector<int> node_ids_;
+    // cpus of each node
+    std::vector<std::vector<int> > node_cpus_;
+
+public:
+    NumaAlloc();
+    // topology of this host, read once
+    static const NumaAlloc &system();
+
+    int nodes() const;
+    const std::vector<int> &cpus(const int &node) const;
+    // first row of the block placed on node
+    std::size_t first_row(const int &node, const std::size_t &rows) const;
+    /**
+     * cpu for worker of workers, filling nodes in turn so that
+     * consecutive workers share a node
+     */
+    int cpu(const int &worker, const int &workers) const;
+
+    /**
+     * rows x cols matrix copied from src, or zeroed if src is null.
+     * Release with release() and the same dimensions.
+     * PLACEMENT_FIRST_TOUCH starts one thread per node and only pays
+     * off when threads on every node scan the rows; a matrix read by
+     * one thread belongs on that thread's node.
+     */
+    int *alloc(const std::size_t &rows, const std::size_t &cols, const int *src, 
+            const Placement &placement = PLACEMENT_LOCAL) const;
+    static void release(int *, const std::size_t &rows, const std::size_t &cols);
+
+    // pin the calling thread; return false if the kernel refuses
+    static bool pin(const int &cpu);
+    bool pin_node(const int &node) const;
+};
+
+#endif
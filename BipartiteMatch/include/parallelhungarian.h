@@ -0,0 +1,94 @@
+/**
+ * parallelhungarian.h
+ * ParallelHungarian class solves the same maximum weight
+ * assignment as Hungarian with a team of threads, for large
+ * dense weight matrices. The columns are split into one block
+ * per thread, and every step of the search updates and
+ * minimizes the column slacks in parallel.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#ifndef PARALLELHUNGARIAN_H
+#define PARALLELHUNGARIAN_H
+
+#include <atomic>
+#include <cstddef>
+
+class ParallelHungarian {
+private:
+    /**
+     * per-thread result of a step, double buffered by step parity
+     * and padded to a cache line
+     */
+    struct Candidate {
+        long long slack[2];
+        int col[2];
+        char pad[64 - 3 * sizeof(long long)];
+    };
+    // sense-reversing spin barrier for the team
+    struct Barrier {
+        std::atomic<int> arrived;
+        char pad[64 - sizeof(std::atomic<int>)];
+        std::atomic<int> generation;
+    };
+
+    const int len_;
+    const int threads_;
+    const bool pin_;
+    /**
+     * len_ x len_ weights, each thread having first written its own
+     * column block. Internally rows and columns are numbered from 1,
+     * with column 0 standing for the row being added.
+     */
+    int *weights_;
+    // labels of rows and columns, as costs (negated weights)
+    long long *u_;
+    long long *v_;
+    // smallest slack to each column from the search tree
+    long long *minv_;
+    // row matched to each column, 0 if none
+    int *p_;
+    // previous column on the search path to each column
+    int *way_;
+    // 1 for columns in the search tree
+    int *used_;
+    int *match_by_X_;
+    Candidate *candidates_;
+    Barrier barrier_;
+
+public:
+    /**
+     * threads 0 uses every hardware thread. With pin, thread t
+     * is pinned to NumaAlloc::cpu(t, threads)
+     */
+    ParallelHungarian(const int *weights, const int &len, const int &threads = 0, 
+            const bool &pin = false);
+    ~ParallelHungarian();
+    ParallelHungarian(const ParallelHungarian &) = delete;
+    ParallelHungarian &operator=(const ParallelHungarian &) = delete;
+
+    // run the algorithm to get the matching
+    void init();
+    long long get_match_total() const;
+    int matchX(const int &) const;
+    int matchY(const int &) const;
+    int length() const;
+    int threads() const;
+    int weight(const int &, const int &) const;
+
+private:
+    // start threads 1 .. threads_ - 1 on task and run thread 0 on this one
+    template <class Task> void team(const Task &task);
+    void copy_weights(const int &t, const int *weights);
+    void solve(const int &t);
+    void wait();
+    // first column of thread t's block
+    int first_col(const int &t) const;
+};
+
+#endif
@@ -0,0 +1,76 @@
+/**
+ * reduction.h
+ * Reduction class shrinks a maximum weight matching problem
+ * before handing it to Hungarian, then maps the solution
+ * back to the original vertices.
+ * Rectangular weights are accepted and solved with X as
+ * the smaller side, padded with 0 weight rows.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#ifndef REDUCTION_H
+#define REDUCTION_H
+
+#include "index.h"
+
+class Reduction {
+private:
+    const int rows_;
+    const int cols_;
+    // true if rows > cols, so X of the solved problem is the input's Y
+    const bool transposed_;
+    // side of the padded square problem
+    const int len_;
+    const Index index_;
+    // len_ x len_ padded weights in solving orientation
+    int *weights_;
+    // row maxima, then column reduction
+    int *labelsX_;
+    int *labelsY_;
+    // 1 for edges which can be in an optimal matching
+    int *allowed_;
+    // solution in solving orientation
+    int *matchX_;
+    int *matchY_;
+    int reduced_len_;
+    int forced_;
+    int pruned_;
+
+public:
+    Reduction(const int *weights, const int &rows, const int &cols);
+    ~Reduction();
+    Reduction(const Reduction &) = delete;
+    Reduction &operator=(const Reduction &) = delete;
+
+    // reduce, solve the rest with Hungarian and map back
+    void init();
+    int get_match_total() const;
+    /**
+     * get the Y element matching a given X element in the
+     * input orientation. return -1 if no element matches
+     */
+    int matchX(const int &) const;
+    int matchY(const int &) const;
+    // side of the square problem before reduction
+    int length() const;
+    // side of the problem given to Hungarian
+    int reduced_length() const;
+    // matches fixed without Hungarian
+    int forced() const;
+    // edges shown to be in no optimal matching
+    int pruned() const;
+
+private:
+    void reduce_labels();
+    int greedy_total() const;
+    void prune(const int &gap);
+    void force();
+    void solve_rest();
+};
+
+#endif
@@ -0,0 +1,78 @@
+/**
+ * reorder.h
+ * Reorder class renumbers the X and Y vertices of a bipartite
+ * graph, which changes the order in which MaxMatch tries free
+ * vertices and edges, finds a maximum matching of the renumbered
+ * graph with MaxMatch and reports it in the original numbering.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#ifndef REORDER_H
+#define REORDER_H
+
+#include "maxmatch.h"
+
+class Reorder {
+public:
+    enum Order {
+        // input numbering
+        ORDER_NONE,
+        // increasing degree, so constrained vertices are matched first
+        ORDER_DEGREE,
+        /**
+         * reverse Cuthill-McKee: breadth first from the lowest degree
+         * vertex of each component, neighbors by degree, reversed.
+         * Needs adjacency lists of 2 ints per edge while numbering
+         */
+        ORDER_RCM
+    };
+
+private:
+    const int rows_;
+    const int cols_;
+    const Order order_;
+    // new number of each original vertex and original of each new number
+    int *newX_;
+    int *newY_;
+    int *oldX_;
+    int *oldY_;
+    // matching of the renumbered graph
+    MaxMatch *matcher_;
+
+public:
+    Reorder(const int *graph, const int &rows, const int &cols, const Order &order);
+    ~Reorder();
+    Reorder(const Reorder &) = delete;
+    Reorder &operator=(const Reorder &) = delete;
+
+    // run the algorithm to get the matching
+    void init();
+    /**
+     * get the Y element matching a given X element.
+     * return -1 if no element matches
+     */
+    int match_X(const int &) const;
+    int match_Y(const int &) const;
+    int matches() const;
+    // new number of an original vertex
+    int new_X(const int &) const;
+    int new_Y(const int &) const;
+    int sizeX() const;
+    int sizeY() const;
+
+private:
+    void number_by_degree(const int *graph);
+    /**
+     * number vertices in reverse Cuthill-McKee order; X vertices
+     * are 0 .. rows_ - 1 and Y vertices rows_ .. rows_ + cols_ - 1
+     * in the combined order
+     */
+    void number_by_rcm(const int *graph);
+};
+
+#endif
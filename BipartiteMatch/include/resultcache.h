@@ -0,0 +1,96 @@
+/**
+ * resultcache.h
+ * ResultCache class keeps recent Hungarian results keyed by
+ * a hash of the weight matrix. A cached result is only used
+ * after its optimality certificate, the vertex labels, has
+ * been checked against the weights in O(n^2), so hash
+ * collisions can't return a wrong answer.
+ * Only exact repeats are served from the cache. A near-exact
+ * repeat hashes differently, but is solved from the labels of
+ * the most recent result of the same size, made feasible for
+ * the new weights, rather than from scratch.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#ifndef RESULTCACHE_H
+#define RESULTCACHE_H
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+class ResultCache {
+private:
+    struct Entry {
+        unsigned long long key;
+        int len;
+        std::vector<int> matchX;
+        std::vector<int> labelsX;
+        std::vector<int> labelsY;
+        std::size_t bytes;
+        // place of key in by_len_[len]
+        std::list<unsigned long long>::iterator same_len;
+    };
+    const std::size_t max_bytes_;
+    std::size_t bytes_;
+    // most recently used first
+    std::list<Entry> entries_;
+    std::unordered_map<unsigned long long, std::list<Entry>::iterator> index_;
+    // keys of the entries of each length, most recently used first
+    std::unordered_map<int, std::list<unsigned long long>> by_len_;
+    std::size_t hits_;
+    std::size_t misses_;
+    // hits whose certificate didn't verify
+    std::size_t rejected_;
+    // misses solved from the labels of an earlier result
+    std::size_t warm_starts_;
+    std::size_t evictions_;
+
+public:
+    /**
+     * max_bytes bounds the memory held by cached results,
+     * least recently used results are evicted first
+     */
+    explicit ResultCache(const std::size_t &max_bytes);
+
+    /**
+     * maximum weight matching of the len x len weights, from the
+     * cache if possible, else solved with Hungarian and cached.
+     * Writes the Y vertex matched to each X vertex to matchX
+     * and returns the total weight
+     */
+    int solve(const int *weights, const int &len, int *matchX);
+    /**
+     * check that matchX is a perfect matching, that the labels are
+     * feasible (labelsX[x] + labelsY[y] >= weight(x, y) for all x, y)
+     * and that matched edges are tight. Together these prove the
+     * matching has maximum weight.
+     */
+    static bool verify(const int *weights, const int &len, const int *matchX, 
+            const int *labelsX, const int *labelsY);
+    static unsigned long long hash(const int *weights, const int &len);
+
+    std::size_t hits() const;
+    std::size_t misses() const;
+    std::size_t rejected() const;
+    std::size_t warm_starts() const;
+    std::size_t evictions() const;
+    std::size_t bytes() const;
+    std::size_t size() const;
+
+private:
+    void insert(const unsigned long long &, Entry &);
+    void erase(const std::list<Entry>::iterator &);
+    // move to the front of entries_ and of its length's keys
+    void touch(const std::list<Entry>::iterator &);
+    // most recently used entry of the given length, or entries_.end()
+    std::list<Entry>::iterator latest(const int &len);
+};
+
+#endif
@@ -0,0 +1,133 @@
+/**
+ * shmring.h
+ * ShmRing class is a lock-free ring of request slots in
+ * POSIX shared memory, through which local clients hand
+ * matching problems to the solver daemon (solverd) and get
+ * the results back in place.
+ *
+ * Each slot holds its problem matrix and its result, so
+ * neither side copies a matrix through the kernel.
+ * Slots are claimed by ticket: slot t % slots() serves ticket t,
+ * and its sequence number moves through
+ *     t          free for the client holding ticket t
+ *     t + 1      request submitted
+ *     t + 2      result ready
+ *     t + slots  released, free for ticket t + slots
+ * A client whose wait() gives up abandons its slot, and the
+ * server releases the slot when it completes the request.
+ * Exactly one side sees the other's mark on Slot::abandoned,
+ * so the slot is released exactly once.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#ifndef SHMRING_H
+#define SHMRING_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+class ShmRing {
+public:
+    enum Kind { KIND_HUNGARIAN, KIND_MAXMATCH, KIND_SHUTDOWN };
+    // STATUS_STOPPED: the server stopped before solving the request
+    enum Status { STATUS_OK, STATUS_INVALID, STATUS_STOPPED };
+
+    struct Slot {
+        std::atomic<unsigned long long> seq;
+        // set by whichever of client and server gives up the slot first
+        std::atomic<int> abandoned;
+        // request
+        int kind;
+        int rows;
+        int cols;
+        // result
+        int status;
+        long long total;
+    };
+
+private:
+    struct Header {
+        unsigned long long magic;
+        int slots;
+        int max_len;
+        std::size_t slot_bytes;
+        std::atomic<int> stop;
+        // producers and consumers on separate cache lines
+        alignas(64) std::atomic<unsigned long long> head;
+        alignas(64) std::atomic<unsigned long long> tail;
+    };
+    static const unsigned long long MAGIC = 0x676e6972746d6873ULL;
+
+    char name_[256];
+    const bool owner_;
+    std::size_t bytes_;
+    Header *header_;
+    char *slots_;
+
+public:
+    /**
+     * create the ring with the given shared memory name,
+     * number of slots (at least 3) and largest matrix side.
+     * The creating process unlinks the name on destruction.
+     * Throws std::runtime_error if the segment can't be created,
+     * including when a segment of that name already exists.
+     */
+    ShmRing(const char *name, const int &slots, const int &max_len);
+    /**
+     * attach to a ring created by another process.
+     * Throws std::runtime_error if there is no such ring.
+     */
+    explicit ShmRing(const char *name);
+    ~ShmRing();
+    ShmRing(const ShmRing &) = delete;
+    ShmRing &operator=(const ShmRing &) = delete;
+
+    int slots() const;
+    int max_len() const;
+    Slot &slot(const unsigned long long &ticket) const;
+    // rows x cols problem matrix of the slot serving ticket
+    int *matrix(const unsigned long long &ticket) const;
+    // X vertex matches of the slot serving ticket
+    int *match(const unsigned long long &ticket) const;
+
+    /**
+     * client side: claim the next free slot. A ticket is only
+     * taken once its slot is free, so giving up leaves the ring
+     * intact. Return false if the ring is stopped or the
+     * deadline passes first.
+     */
+    bool acquire(unsigned long long &ticket, const std::chrono::steady_clock::time_point &deadline = 
+            std::chrono::steady_clock::time_point::max());
+    void submit(const unsigned long long &ticket);
+    /**
+     * wait for the result of a submitted request.
+     * Return false if the ring is stopped or the deadline passes
+     * first. The slot is then abandoned to the server and must
+     * not be touched or released.
+     */
+    bool wait(const unsigned long long &ticket, const std::chrono::steady_clock::time_point &deadline = 
+            std::chrono::steady_clock::time_point::max());
+    void release(const unsigned long long &ticket);
+
+    /**
+     * server side: claim the oldest submitted request if there is one.
+     * Return false if the next request hasn't been submitted yet.
+     */
+    bool take(unsigned long long &ticket);
+    // publish the result, or release the slot if its client gave up
+    void complete(const unsigned long long &ticket);
+    void request_stop();
+    bool stopped() const;
+
+private:
+    void map(const int &fd, const std::size_t &bytes);
+    static void backoff(int &spins);
+};
+
+#endif
@@ -0,0 +1,148 @@
+/**
+ * bottleneck.cpp
+ * Bottleneck assignment by threshold search.
+ * Edges sorted by weight go into a single MaxMatch, and each
+ * threshold tried is matched starting from the maximum matching
+ * of the largest threshold known to fail, which is still a
+ * matching of the larger graph. Thresholds first grow by a
+ * doubling number of edges until one has a perfect matching,
+ * then the range left is halved, so there are O(log(len)) probes
+ * rather than one per distinct weight, each a dense O(len^2)
+ * search when it fails.
+ *
+ * No threshold below the largest row or column minimum can
+ * match every vertex, so the search starts from that bound.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "bottleneck.h"
+#include "index.h"
+#include "maxmatch.h"
+
+Bottleneck::Bottleneck(const int *weights, const int &len) : len_(len), index_(len_), 
+        threshold_(0), probes_(0), matcher_(len, len), added_(0), saved_(len, -1) {
+    std::size_t cells = static_cast<std::size_t>(len_) * len_;
+
+    weights_ = new int[cells];
+    order_ = new std::size_t[cells];
+    for (std::size_t i = 0; i < cells; ++i) {
+        weights_[i] = weights[i];
+        order_[i] = i;
+    }
+}
+
+Bottleneck::~Bottleneck() {
+    delete[] weights_;
+    delete[] order_;
+}
+
+void Bottleneck::init() {
+    std::size_t cells = static_cast<std::size_t>(len_) * len_,
+        lo_end, hi_end, step, pos;
+    int lower = std::numeric_limits<int>::min(),
+        w, i, j;
+
+    if (len_ == 0) return;
+    std::sort(order_, order_ + cells, [this](const std::size_t &a, const std::size_t &b) {
+        return weights_[a] < weights_[b];
+    });
+    // every row and every column needs one of its edges
+    for (i = 0; i < len_; ++i) {
+        int row_min = weights_[index_.index(i, 0)],
+            col_min = weights_[index_.index(0, i)];
+        for (j = 1; j < len_; ++j) {
+            row_min = std::min(row_min, weights_[index_.index(i, j)]);
+            col_min = std::min(col_min, weights_[index_.index(j, i)]);
+        }
+        lower = std::max(lower, std::max(row_min, col_min));
+    }
+    threshold_ = lower;
+    if (probe(lower)) return;
+    // grow until a threshold has a perfect matching
+    lo_end = added_;
+    for (step = len_; ; step *= 2) {
+        // all edges match a complete graph
+        pos = std::min(lo_end + step, cells) - 1;
+        threshold_ = weights_[order_[pos]];
+        if (probe(threshold_)) break;
+        lo_end = added_;
+    }
+    // the bottleneck is a weight of the edges lo_end .. hi_end - 1
+    hi_end = added_;
+    while (true) {
+        pos = lo_end + (hi_end - lo_end) / 2;
+        w = weights_[order_[pos]];
+        if (w == threshold_) {
+            // the upper half has one weight, try the largest below it
+            pos = std::lower_bound(order_ + lo_end, order_ + hi_end, threshold_, 
+                    [this](const std::size_t &e, const int &v) { return weights_[e] < v; }) - order_;
+            if (pos == lo_end) break;
+            w = weights_[order_[pos - 1]];
+        }
+        if (probe(w)) {
+            threshold_ = w;
+            hi_end = added_;
+        } else {
+            lo_end = added_;
+        }
+    }
+    // the last probe may have failed, leaving a smaller matching
+    if (added_ != hi_end) probe(threshold_);
+}
+
+std::size_t Bottleneck::prefix(const int &w) const {
+    std::size_t cells = static_cast<std::size_t>(len_) * len_;
+
+    return std::upper_bound(order_, order_ + cells, w, 
+            [this](const int &v, const std::size_t &e) { return v < weights_[e]; }) - order_;
+}
+
+bool Bottleneck::probe(const int &w) {
+    std::size_t end = prefix(w);
+
+    // saved_ only uses edges below every threshold still tried
+    matcher_.set_match(saved_.data());
+    for (; added_ < end; ++added_) {
+        matcher_.add_graph_edge(index_.row(order_[added_]), index_.col(order_[added_]));
+    }
+    while (added_ > end) {
+        --added_;
+        matcher_.delete_graph_edge(index_.row(order_[added_]), index_.col(order_[added_]));
+    }
+    ++probes_;
+    matcher_.init();
+    if (matcher_.matches() == len_) return true;
+    for (int x = 0; x < len_; ++x) {
+        saved_[x] = matcher_.match_X(x);
+    }
+    return false;
+}
+
+int Bottleneck::threshold() const {
+    return threshold_;
+}
+
+int Bottleneck::probes() const {
+    return probes_;
+}
+
+int Bottleneck::matchX(const int &x) const {
+    return matcher_.match_X(x);
+}
+
+int Bottleneck::matchY(const int &y) const {
+    return matcher_.match_Y(y);
+}
+
+int Bottleneck::length() const {
+    return len_;
+}
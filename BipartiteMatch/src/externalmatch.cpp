@@ -0,0 +1,320 @@
+/**
+ * externalmatch.cpp
+ * Hopcroft-Karp maximum matching over adjacency mapped from disk.
+ * Each BFS layer is sorted by vertex so that its adjacency is read
+ * in file order, and the kernel is asked to read the next
+ * PREFETCH_BYTES of it while the current block is scanned. The DFS
+ * of a phase only follows edges of the layers just scanned, so it
+ * mostly finds its pages still cached.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <algorithm>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "externalmatch.h"
+
+ExternalMatch::ExternalMatch(const char *path) : rows_(0), cols_(0), edges_(0),
+        last_layer_(-1), matches_(0), phases_(0) {
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0) throw std::runtime_error(std::string("cannot open ") + path);
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(Header))) {
+        close(fd);
+        throw std::runtime_error(std::string("not a matching graph: ") + path);
+    }
+    map_bytes_ = st.st_size;
+    map_ = mmap(nullptr, map_bytes_, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map_ == MAP_FAILED) throw std::runtime_error(std::string("mmap failed for ") + path);
+
+    // the file is external input: check every size before using it
+    const Header *header = static_cast<const Header *>(map_);
+    const std::uint64_t max_int = std::numeric_limits<int>::max();
+    std::size_t offset_bytes = 0;
+    bool valid = header->magic == MAGIC && header->rows <= max_int && header->cols <= max_int;
+    if (valid) {
+        // cannot overflow with rows <= INT_MAX
+        offset_bytes = sizeof(Header) + (header->rows + 1) * sizeof(std::uint64_t);
+        valid = offset_bytes <= map_bytes_ && 
+            (map_bytes_ - offset_bytes) % sizeof(std::int32_t) == 0 &&
+            (map_bytes_ - offset_bytes) / sizeof(std::int32_t) == header->edges;
+    }
+    if (!valid) {
+        munmap(map_, map_bytes_);
+        throw std::runtime_error(std::string("not a matching graph: ") + path);
+    }
+    rows_ = header->rows;
+    cols_ = header->cols;
+    edges_ = header->edges;
+    adj_ = reinterpret_cast<const std::int32_t *>(static_cast<const char *>(map_) + offset_bytes);
+
+    // offsets must start at 0, never decrease and end at edges_
+    const std::uint64_t *offsets = reinterpret_cast<const std::uint64_t *>(header + 1);
+    first_ = new std::uint64_t[rows_ + 1];
+    valid = offsets[0] == 0 && offsets[rows_] == edges_;
+    for (int x = 0; x < rows_; ++x) {
+        first_[x] = offsets[x];
+        valid = valid && offsets[x] <= offsets[x + 1];
+    }
+    first_[rows_] = offsets[rows_];
+    if (!valid) {
+        munmap(map_, map_bytes_);
+        delete[] first_;
+        throw std::runtime_error(std::string("bad offsets in matching graph: ") + path);
+    }
+    cursor_ = new std::uint64_t[rows_];
+    dist_ = new int[rows_];
+    queue_ = new int[rows_];
+    matchX_ = new int[rows_];
+    matchY_ = new int[cols_];
+    std::fill(matchX_, matchX_ + rows_, -1);
+    std::fill(matchY_, matchY_ + cols_, -1);
+}
+
+ExternalMatch::~ExternalMatch() {
+    munmap(map_, map_bytes_);
+    delete[] first_;
+    delete[] cursor_;
+    delete[] dist_;
+    delete[] queue_;
+    delete[] matchX_;
+    delete[] matchY_;
+}
+
+void ExternalMatch::write(const char *path, const int *x, const int *y, const std::size_t &edges,
+        const int &rows, const int &cols) {
+    std::size_t offset_bytes = sizeof(Header) + (static_cast<std::size_t>(rows) + 1) * sizeof(std::uint64_t),
+        bytes = offset_bytes + edges * sizeof(std::int32_t),
+        k;
+    int fd = open(path, O_CREAT | O_RDWR | O_TRUNC, 0644),
+        i;
+
+    if (fd < 0) throw std::runtime_error(std::string("cannot create ") + path);
+    if (ftruncate(fd, bytes) != 0) {
+        close(fd);
+        throw std::runtime_error(std::string("ftruncate failed for ") + path);
+    }
+    void *addr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) throw std::runtime_error(std::string("mmap failed for ") + path);
+
+    Header *header = new (addr) Header;
+    std::uint64_t *first = reinterpret_cast<std::uint64_t *>(header + 1);
+    std::int32_t *adj = reinterpret_cast<std::int32_t *>(static_cast<char *>(addr) + offset_bytes);
+
+    // counting sort of the edges by X vertex
+    std::fill(first, first + rows + 1, 0);
+    for (k = 0; k < edges; ++k) {
+        ++first[x[k] + 1];
+    }
+    for (i = 0; i < rows; ++i) {
+        first[i + 1] += first[i];
+    }
+    for (k = 0; k < edges; ++k) {
+        adj[first[x[k]]++] = y[k];
+    }
+    // first[i] now holds the end of vertex i
+    for (i = rows; i > 0; --i) {
+        first[i] = first[i - 1];
+    }
+    first[0] = 0;
+    header->rows = rows;
+    header->cols = cols;
+    header->edges = edges;
+    header->magic = MAGIC;
+    munmap(addr, bytes);
+}
+
+void ExternalMatch::init() {
+    std::uint64_t e;
+    int block_end, ahead, x;
+
+    std::fill(matchX_, matchX_ + rows_, -1);
+    std::fill(matchY_, matchY_ + cols_, -1);
+    matches_ = 0;
+    phases_ = 0;
+    /**
+     * greedy matching in one pass over the file saves the early
+     * phases. The pass reads every edge, so it also range-checks
+     * the adjacency before any search indexes matchY_ with it.
+     */
+    for (x = 0; x < rows_; ++x) {
+        queue_[x] = x;
+    }
+    block_end = prefetch(0, rows_);
+    ahead = prefetch(block_end, rows_);
+    for (x = 0; x < rows_; ++x) {
+        if (x == block_end) {
+            block_end = ahead;
+            ahead = prefetch(ahead, rows_);
+        }
+        for (e = first_[x]; e < first_[x + 1]; ++e) {
+            if (adj_[e] < 0 || adj_[e] >= cols_) {
+                throw std::runtime_error("Y vertex out of range in matching graph");
+            }
+            if (matchX_[x] < 0 && matchY_[adj_[e]] < 0) {
+                matchX_[x] = adj_[e];
+                matchY_[adj_[e]] = x;
+                ++matches_;
+            }
+        }
+    }
+    while (bfs()) {
+        ++phases_;
+        std::copy(first_, first_ + rows_, cursor_);
+        for (x = 0; x < rows_; ++x) {
+            if (matchX_[x] < 0 && dfs(x)) ++matches_;
+        }
+    }
+}
+
+bool ExternalMatch::bfs() {
+    std::uint64_t e;
+    int tail = 0,
+        lo, hi, k,
+        block_end, ahead,
+        x, next;
+
+    std::fill(dist_, dist_ + rows_, -1);
+    for (x = 0; x < rows_; ++x) {
+        if (matchX_[x] < 0) {
+            dist_[x] = 0;
+            queue_[tail++] = x;
+        }
+    }
+    last_layer_ = -1;
+    for (lo = 0; lo < tail && last_layer_ < 0; lo = hi) {
+        hi = tail;
+        // read the layer's adjacency in file order
+        std::sort(queue_ + lo, queue_ + hi);
+        block_end = prefetch(lo, hi);
+        ahead = prefetch(block_end, hi);
+        for (k = lo; k < hi; ++k) {
+            if (k == block_end) {
+                block_end = ahead;
+                ahead = prefetch(ahead, hi);
+            }
+            x = queue_[k];
+            for (e = first_[x]; e < first_[x + 1]; ++e) {
+                next = matchY_[adj_[e]];
+                if (next < 0) {
+                    last_layer_ = dist_[x];
+                } else if (dist_[next] < 0) {
+                    dist_[next] = dist_[x] + 1;
+                    queue_[tail++] = next;
+                }
+            }
+        }
+    }
+    return last_layer_ >= 0;
+}
+
+bool ExternalMatch::dfs(const int &start) {
+    int x, y, next;
+
+    stack_.clear();
+    stack_.push_back(start);
+    while (!stack_.empty()) {
+        x = stack_.back();
+        if (cursor_[x] == first_[x + 1]) {
+            // no shortest augmenting path through x in this phase
+            dist_[x] = -1;
+            stack_.pop_back();
+            continue;
+        }
+        y = adj_[cursor_[x]];
+        next = matchY_[y];
+        if (next < 0 && dist_[x] == last_layer_) {
+            // flip the path, each X vertex takes its current edge
+            for (std::size_t k = stack_.size(); k-- > 0;) {
+                x = stack_[k];
+                y = adj_[cursor_[x]];
+                matchX_[x] = y;
+                matchY_[y] = x;
+            }
+            return true;
+        }
+        if (next >= 0 && dist_[x] < last_layer_ && dist_[next] == dist_[x] + 1) {
+            stack_.push_back(next);
+        } else {
+            ++cursor_[x];
+        }
+    }
+    return false;
+}
+
+int ExternalMatch::prefetch(const int &from, const int &to) const {
+    static const std::size_t page = sysconf(_SC_PAGESIZE);
+    const char *base = reinterpret_cast<const char *>(adj_);
+    std::size_t bytes = 0,
+        run_begin = 0,
+        run_end = 0,
+        begin, end;
+    int k;
+
+    // merge the ranges of consecutive vertices into one request
+    auto advise = [&]() {
+        if (run_end == run_begin) return;
+        std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(base + run_begin) & ~(page - 1);
+        madvise(reinterpret_cast<void *>(addr), reinterpret_cast<std::uintptr_t>(base + run_end) - addr,
+                MADV_WILLNEED);
+    };
+    for (k = from; k < to && bytes < PREFETCH_BYTES; ++k) {
+        begin = first_[queue_[k]] * sizeof(std::int32_t);
+        end = first_[queue_[k] + 1] * sizeof(std::int32_t);
+        if (begin == end) continue;
+        if (begin < run_begin || begin > run_end + page) {
+            advise();
+            run_begin = begin;
+            run_end = end;
+        } else {
+            run_end = std::max(run_end, end);
+        }
+        bytes += end - begin;
+    }
+    advise();
+    return k;
+}
+
+int ExternalMatch::match_X(const int &x) const {
+    return matchX_[x];
+}
+
+int ExternalMatch::match_Y(const int &y) const {
+    return matchY_[y];
+}
+
+int ExternalMatch::matches() const {
+    return matches_;
+}
+
+int ExternalMatch::phases() const {
+    return phases_;
+}
+
+std::size_t ExternalMatch::edges() const {
+    return edges_;
+}
+
+int ExternalMatch::sizeX() const {
+    return rows_;
+}
+
+int ExternalMatch::sizeY() const {
+    return cols_;
+}
@@ -17,44 +17,127 @@
  */
 
 #include <algorithm>
+#include <utility>
 
 #include "hungarian.h"
 #include "maxmatch.h"
 #include "index.h"
+#include "numaalloc.h"
 
-Hungarian::Hungarian(const int *weights, const int &len) : 
-        len_(len), len_sq_(len_ * len_), index_(len_), matcher_(weights, len_, len_) {
+Hungarian::Hungarian(const int *weights, const int &len, const NumaAlloc::Placement &placement) : 
+        Hungarian(weights, len, nullptr, nullptr, placement) {}
+
+Hungarian::Hungarian(const int *weights, const int &len, const int *labelsX, 
+        const int *labelsY, const NumaAlloc::Placement &placement) : len_(0), len_sq_(0), 
+        capacity_(0), placement_(placement), weights_(nullptr), equality_graph_(nullptr), 
+        labelsX_(nullptr), labelsY_(nullptr), S_(nullptr), T_(nullptr), NlS_(nullptr), 
+        index_(0), matcher_(nullptr, 0, 0, placement) {
+    reassign(weights, len, labelsX, labelsY);
+}
+
+Hungarian::Hungarian(Hungarian &&other) noexcept : len_(other.len_), len_sq_(other.len_sq_), 
+        capacity_(other.capacity_), placement_(other.placement_), weights_(other.weights_), 
+        equality_graph_(other.equality_graph_), labelsX_(other.labelsX_), 
+        labelsY_(other.labelsY_), S_(other.S_), T_(other.T_), NlS_(other.NlS_), 
+        index_(other.index_), matcher_(std::move(other.matcher_)) {
+    other.len_ = 0;
+    other.len_sq_ = 0;
+    other.capacity_ = 0;
+    other.weights_ = nullptr;
+    other.equality_graph_ = nullptr;
+    other.labelsX_ = nullptr;
+    other.labelsY_ = nullptr;
+    other.S_ = nullptr;
+    other.T_ = nullptr;
+    other.NlS_ = nullptr;
+    other.index_ = Index(0);
+}
+
+/**
+ * other is emptied into a temporary, which takes the arrays
+ * of this solver and frees them when it goes out of scope
+ */
+Hungarian &Hungarian::operator=(Hungarian &&other) noexcept {
+    if (this != &other) {
+        Hungarian tmp(std::move(other));
+        swap(tmp);
+    }
+    return *this;
+}
+
+void Hungarian::swap(Hungarian &other) noexcept {
+    std::swap(len_, other.len_);
+    std::swap(len_sq_, other.len_sq_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(placement_, other.placement_);
+    std::swap(weights_, other.weights_);
+    std::swap(equality_graph_, other.equality_graph_);
+    std::swap(labelsX_, other.labelsX_);
+    std::swap(labelsY_, other.labelsY_);
+    std::swap(S_, other.S_);
+    std::swap(T_, other.T_);
+    std::swap(NlS_, other.NlS_);
+    std::swap(index_, other.index_);
+    std::swap(matcher_, other.matcher_);
+}
+
+void Hungarian::reassign(const int *weights, const int &len, const int *labelsX, 
+        const int *labelsY) {
     int i;
 
-    // initialize weights
-    weights_ = new int[len_sq_];
-    for (i = 0; i < len_sq_; ++i) {
-        weights_[i] = weights[i];
+    len_ = len;
+    len_sq_ = static_cast<std::size_t>(len_) * len_;
+    index_ = Index(len_);
+    if (len_ > capacity_) {
+        int *grown_weights = NumaAlloc::system().alloc(len_, len_, weights, placement_),
+            *grown_graph = NumaAlloc::system().alloc(len_, len_, nullptr, placement_);
+
+        NumaAlloc::release(weights_, capacity_, capacity_);
+        NumaAlloc::release(equality_graph_, capacity_, capacity_);
+        weights_ = grown_weights;
+        equality_graph_ = grown_graph;
+        delete[] labelsX_;
+        delete[] labelsY_;
+        delete[] S_;
+        delete[] T_;
+        delete[] NlS_;
+        labelsX_ = new int[len_];
+        labelsY_ = new int[len_];
+        S_ = new int[len_];
+        T_ = new int[len_];
+        NlS_ = new int[len_];
+        capacity_ = len_;
+    } else {
+        // pages already placed stay where they are
+        std::copy(weights, weights + len_sq_, weights_);
     }
     // initialize vertex labels
-    labelsX_ = new int[len_];
-    labelsY_ = new int[len_];
     for (i = 0; i < len_; ++i) {
-        labelsX_[i] = *std::max_element(weights_ + index_.index(i, 0), 
-                weights_ + index_.index(i + 1, 0));
-        labelsY_[i] = 0;
+        if (labelsX != nullptr) {
+            labelsX_[i] = labelsX[i];
+            labelsY_[i] = labelsY[i];
+        } else {
+            labelsX_[i] = *std::max_element(weights_ + index_.index(i, 0), 
+                    weights_ + index_.index(i + 1, 0));
+            labelsY_[i] = 0;
+        }
     }
     //initialize equality graph to starting values
-    equality_graph_ = new int[len_sq_];
     update_equality_graph();
     // set matcher to initial equality graph
-    matcher_.set(equality_graph_);
+    matcher_.reassign(equality_graph_, len_, len_);
     matcher_.init();
-    // initialize S_, T_, NlS_
-    S_ = new int[len_];
-    T_ = new int[len_];
-    NlS_ = new int[len_];
 }
+
+std::size_t Hungarian::capacity() const {
+    return static_cast<std::size_t>(capacity_) * capacity_;
+}
+
 Hungarian::~Hungarian() {
-    delete[] weights_;
+    NumaAlloc::release(weights_, capacity_, capacity_);
     delete[] labelsX_;
     delete[] labelsY_;
-    delete[] equality_graph_;
+    NumaAlloc::release(equality_graph_, capacity_, capacity_);
     delete[] S_;
     delete[] T_;
     delete[] NlS_;
@@ -72,11 +155,46 @@ int Hungarian::get_match_total() {
 }
 
 void Hungarian::init() {
-    while (matcher_.matches() < len_) {
+    init(std::chrono::steady_clock::time_point::max());
+}
+
+/**
+ * relabel() keeps every matched edge tight, since both ends of a
+ * matched edge in the tree are relabelled by alpha in opposite
+ * directions, so each phase extends the matching of the last one
+ * instead of matching the equality graph from scratch. The matcher
+ * checks the deadline between its augmenting passes, which also
+ * finishes a matching left partial by an earlier stop.
+ */
+bool Hungarian::init(const std::chrono::steady_clock::time_point &deadline, 
+        const std::atomic<bool> *cancel) {
+    while (true) {
+        if (!matcher_.init(deadline, cancel)) return false;
+        if (matcher_.matches() == len_) return true;
+        if (std::chrono::steady_clock::now() >= deadline || 
+                (cancel != nullptr && cancel->load(std::memory_order_relaxed))) {
+            return false;
+        }
         improve_equality_graph();
-        matcher_.set(equality_graph_);
-        matcher_.init();
+        matcher_.set_graph(equality_graph_);
+    }
+}
+
+int Hungarian::get_dual_bound() const {
+    int total = 0;
+
+    for (int i = 0; i < len_; ++i) {
+        total += labelsX_[i] + labelsY_[i];
     }
+    return total;
+}
+
+int Hungarian::labelX(const int &x) const {
+    return labelsX_[x];
+}
+
+int Hungarian::labelY(const int &y) const {
+    return labelsY_[y];
 }
 
 int Hungarian::length() const {
@@ -15,35 +15,94 @@
  */
 
 #include <algorithm>
+#include <utility>
 
 #include "index.h"
 #include "maxmatch.h"
+#include "numaalloc.h"
 
-MaxMatch::MaxMatch(const int *graph, const int &X_size, 
-        const int &Y_size) : rows_(X_size), cols_(Y_size), index_(Y_size) {
-    graph_ = new int[rows_ * cols_];
-    match_by_X_ = new int[rows_];
-    match_by_Y_ = new int[cols_];
-    childX_ = new int[rows_];
+// replace data by an uninitialized array of len ints
+static void reallocate(int *&data, const int &len) {
+    int *grown = new int[len];
 
-    set(graph);
+    delete[] data;
+    data = grown;
+}
+
+MaxMatch::MaxMatch(const int *graph, const int &X_size, const int &Y_size, 
+        const NumaAlloc::Placement &placement) : rows_(0), cols_(0), index_(0), graph_rows_(0), 
+        graph_cols_(0), capX_(0), capY_(0), placement_(placement), graph_(nullptr), match_by_X_(nullptr), match_by_Y_(nullptr), 
+        childX_(nullptr), visitY_(nullptr) {
+    reassign(graph, X_size, Y_size);
+}
+
+MaxMatch::MaxMatch(const int &X_size, const int &Y_size, const NumaAlloc::Placement &placement) : 
+        rows_(0), cols_(0), index_(0), graph_rows_(0), graph_cols_(0), capX_(0), capY_(0), 
+        placement_(placement), graph_(nullptr), match_by_X_(nullptr), match_by_Y_(nullptr), 
+        childX_(nullptr), visitY_(nullptr) {
+    // storage is fresh, and NumaAlloc zeroes it
+    resize(X_size, Y_size);
     reset();
 }
 
+MaxMatch::MaxMatch(MaxMatch &&other) noexcept : rows_(0), cols_(0), index_(0), 
+        graph_rows_(0), graph_cols_(0), capX_(0), capY_(0), placement_(other.placement_), 
+        graph_(nullptr), 
+        match_by_X_(nullptr), match_by_Y_(nullptr), childX_(nullptr), visitY_(nullptr) {
+    swap(other);
+}
+
+/**
+ * other is emptied into a temporary, which takes the arrays
+ * of this solver and frees them when it goes out of scope
+ */
+MaxMatch &MaxMatch::operator=(MaxMatch &&other) noexcept {
+    if (this != &other) {
+        MaxMatch tmp(std::move(other));
+        swap(tmp);
+    }
+    return *this;
+}
+
+void MaxMatch::swap(MaxMatch &other) noexcept {
+    std::swap(rows_, other.rows_);
+    std::swap(cols_, other.cols_);
+    std::swap(index_, other.index_);
+    std::swap(graph_rows_, other.graph_rows_);
+    std::swap(graph_cols_, other.graph_cols_);
+    std::swap(capX_, other.capX_);
+    std::swap(capY_, other.capY_);
+    std::swap(placement_, other.placement_);
+    std::swap(graph_, other.graph_);
+    std::swap(match_by_X_, other.match_by_X_);
+    std::swap(match_by_Y_, other.match_by_Y_);
+    std::swap(childX_, other.childX_);
+    std::swap(visitY_, other.visitY_);
+}
+
 MaxMatch::~MaxMatch() {
+    delete[] visitY_;
     delete[] childX_;
     delete[] match_by_Y_;
     delete[] match_by_X_;
-    delete[] graph_;
+    NumaAlloc::release(graph_, graph_rows_, graph_cols_);
 }
 
 // run the algorithm to get the matching
 void MaxMatch::init() {
-    int start_index;
+    // a pass without augmenting paths leaves the marks cover_X() reads
+    while (dfs() > 0) {}
+}
 
-    while ((start_index = dfs()) != -1) {
-        augment_match(start_index);
+bool MaxMatch::init(const std::chrono::steady_clock::time_point &deadline, 
+        const std::atomic<bool> *cancel) {
+    while (dfs() > 0) {
+        if (std::chrono::steady_clock::now() >= deadline || 
+                (cancel != nullptr && cancel->load(std::memory_order_relaxed))) {
+            return false;
+        }
     }
+    return true;
 }
 /**
  * get the column matched to a given row.
@@ -66,14 +125,57 @@ int MaxMatch::match_Y(const int &y) const {
  * columns
  */
 void MaxMatch::set(const int *graph) {
-    int len = rows_ * cols_;
+    std::size_t len = static_cast<std::size_t>(rows_) * cols_;
 
-    for (int i = 0; i < len; ++i) {
+    for (std::size_t i = 0; i < len; ++i) {
         graph_[i] = graph[i] == 0 ? 0 : 1;
     }
     reset();
 }
 
+void MaxMatch::set_graph(const int *graph) {
+    std::size_t len = static_cast<std::size_t>(rows_) * cols_;
+
+    for (std::size_t i = 0; i < len; ++i) {
+        graph_[i] = graph[i] == 0 ? 0 : 1;
+    }
+}
+
+void MaxMatch::resize(const int &X_size, const int &Y_size) {
+    int *grown;
+
+    // allocate before releasing, so a failure leaves the solver intact
+    if (static_cast<std::size_t>(X_size) * Y_size > graph_rows_ * graph_cols_) {
+        grown = NumaAlloc::system().alloc(X_size, Y_size, nullptr, placement_);
+        NumaAlloc::release(graph_, graph_rows_, graph_cols_);
+        graph_ = grown;
+        graph_rows_ = X_size;
+        graph_cols_ = Y_size;
+    }
+    if (X_size > capX_) {
+        reallocate(match_by_X_, X_size);
+        reallocate(childX_, X_size);
+        capX_ = X_size;
+    }
+    if (Y_size > capY_) {
+        reallocate(match_by_Y_, Y_size);
+        reallocate(visitY_, Y_size);
+        capY_ = Y_size;
+    }
+    rows_ = X_size;
+    cols_ = Y_size;
+    index_ = Index(cols_);
+}
+
+void MaxMatch::reassign(const int *graph, const int &X_size, const int &Y_size) {
+    resize(X_size, Y_size);
+    set(graph);
+}
+
+std::size_t MaxMatch::capacity() const {
+    return graph_rows_ * graph_cols_;
+}
+
 void MaxMatch::add_graph_edge(const int &x, const int &y) {
     graph_[index_.index(x, y)] = 1;
 }
@@ -87,9 +189,18 @@ bool MaxMatch::has_graph_edge(const int &x, const int &y) {
     return graph_[index_.index(x, y)] == 1;
 }
 
+void MaxMatch::set_match(const int *matchX) {
+    reset_matches();
+    for (int x = 0; x < rows_; ++x) {
+        match_by_X_[x] = matchX[x];
+        if (matchX[x] >= 0) match_by_Y_[matchX[x]] = x;
+    }
+}
+
 void MaxMatch::reset() {
     reset_matches();
     reset_childX();
+    reset_visitY();
 }
 
 void MaxMatch::reset_matches() {
@@ -101,19 +212,32 @@ void MaxMatch::reset_childX() {
     std::fill(childX_, childX_ + rows_, -1);
 }
 
+void MaxMatch::reset_visitY() {
+    std::fill(visitY_, visitY_ + cols_, 0);
+}
+
+/**
+ * A vertex marked -2 had no augmenting path while the matching
+ * was unchanged, which may no longer hold after a later augment
+ * in the same pass. The next pass clears the marks, so the
+ * matching is maximum once a whole pass finds nothing.
+ */
 int MaxMatch::dfs() {
+    int paths = 0;
+
     reset_childX();
     for (int i = 0; i < rows_; ++i) {
         if (match_by_X_[i] == -1 && dfs_visit(i)) {
-            return i;
+            augment_match(i);
+            ++paths;
         }
     }
-    return -1;
+    return paths;
 }
 
 bool MaxMatch::dfs_visit(const int &i) {
     // vertex already visited
-    if (childX_[i] >= 0) { return false; }
+    if (childX_[i] != -1) { return false; }
     for (int j = 0; j < cols_; ++j) {
         // we're only looking for unmatched edges
         if (graph_[index_.index(i, j)] == 0 || match_by_X_[i] == j) continue;
@@ -123,10 +247,21 @@ bool MaxMatch::dfs_visit(const int &i) {
         // j is matched, keep going
         if (dfs_visit(match_by_Y_[j])) return true;
     }
-    childX_[i] = -1;
+    // no augmenting path through i while the matching is unchanged
+    childX_[i] = -2;
     return false;
 }
 
+void MaxMatch::dfs_visit_Y(const int &j) {
+    if (visitY_[j] == 1) return;
+    visitY_[j] = 1;
+    for (int i = 0; i < rows_; ++i) {
+        if (graph_[index_.index(i, j)] == 0 || match_by_Y_[j] == i) continue;
+        // i is matched, otherwise the matching would not be maximum
+        if (match_by_X_[i] >= 0) dfs_visit_Y(match_by_X_[i]);
+    }
+}
+
 void MaxMatch::augment_match(int i) {
     int nextX;
 
@@ -149,3 +284,36 @@ int MaxMatch::sizeX() const {
 int MaxMatch::sizeY() const {
     return cols_;
 }
+
+/**
+ * König's theorem: with Z the vertices reachable from free X
+ * vertices by alternating paths, (X - Z) + (Y & Z) is a minimum
+ * vertex cover. Y vertices in Z are exactly the partners of
+ * matched X vertices in Z.
+ */
+bool MaxMatch::cover_X(const int &x) const {
+    return childX_[x] != -2;
+}
+
+bool MaxMatch::cover_Y(const int &y) const {
+    return match_by_Y_[y] >= 0 && childX_[match_by_Y_[y]] == -2;
+}
+
+void MaxMatch::decompose() {
+    reset_visitY();
+    for (int j = 0; j < cols_; ++j) {
+        if (match_by_Y_[j] == -1) dfs_visit_Y(j);
+    }
+}
+
+MaxMatch::DMClass MaxMatch::dm_X(const int &x) const {
+    if (childX_[x] == -2) return DM_EVEN;
+    if (match_by_X_[x] >= 0 && visitY_[match_by_X_[x]] == 1) return DM_ODD;
+    return DM_PERFECT;
+}
+
+MaxMatch::DMClass MaxMatch::dm_Y(const int &y) const {
+    if (visitY_[y] == 1) return DM_EVEN;
+    if (match_by_Y_[y] >= 0 && childX_[match_by_Y_[y]] == -2) return DM_ODD;
+    return DM_PERFECT;
+}
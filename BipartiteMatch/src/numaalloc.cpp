@@ -0,0 +1,182 @@
+/**
+ * numaalloc.cpp
+ * NUMA placement without libnuma: large matrices are mapped
+ * untouched and then either written in row blocks by one
+ * thread pinned to each node, so that Linux's first-touch
+ * policy puts each block on its node, or interleaved with
+ * mbind() before the first write.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <linux/mempolicy.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "numaalloc.h"
+
+// parse a sysfs cpu or node list such as "0-3,8-11"
+static std::vector<int> parse_cpulist(const std::string &list) {
+    std::vector<int> cpus;
+    std::stringstream ss(list);
+    std::string range;
+    int first, last;
+
+    while (std::getline(ss, range, ',')) {
+        if (range.empty() || range[0] == '\n') continue;
+        std::size_t dash = range.find('-');
+        first = std::stoi(range.substr(0, dash));
+        last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+        for (int c = first; c <= last; ++c) {
+            cpus.push_back(c);
+        }
+    }
+    return cpus;
+}
+
+NumaAlloc::NumaAlloc() {
+    std::ifstream online("/sys/devices/system/node/online");
+    std::string list;
+
+    if (online && std::getline(online, list)) {
+        for (int node : parse_cpulist(list)) {
+            std::ifstream in("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+            if (!in || !std::getline(in, list)) continue;
+            std::vector<int> cpus = parse_cpulist(list);
+            // memory-only nodes get no threads
+            if (cpus.empty()) continue;
+            node_ids_.push_back(node);
+            node_cpus_.push_back(cpus);
+        }
+    }
+    if (node_cpus_.empty()) {
+        node_ids_.assign(1, 0);
+        node_cpus_.push_back(std::vector<int>());
+        for (unsigned c = 0; c < std::max(std::thread::hardware_concurrency(), 1U); ++c) {
+            node_cpus_[0].push_back(c);
+        }
+    }
+}
+
+const NumaAlloc &NumaAlloc::system() {
+    static const NumaAlloc topology;
+    return topology;
+}
+
+int NumaAlloc::nodes() const {
+    return node_cpus_.size();
+}
+
+const std::vector<int> &NumaAlloc::cpus(const int &node) const {
+    return node_cpus_[node];
+}
+
+std::size_t NumaAlloc::first_row(const int &node, const std::size_t &rows) const {
+    return rows * node / node_cpus_.size();
+}
+
+int NumaAlloc::cpu(const int &worker, const int &workers) const {
+    int per_node = (workers + nodes() - 1) / nodes(),
+        node = std::min(worker / per_node, nodes() - 1);
+    const std::vector<int> &list = node_cpus_[node];
+
+    return list[(worker - node * per_node) % list.size()];
+}
+
+int *NumaAlloc::alloc(const std::size_t &rows, const std::size_t &cols, const int *src, 
+        const Placement &placement) const {
+    std::size_t bytes = rows * cols * sizeof(int);
+
+    if (bytes < MIN_PLACED_BYTES) {
+        int *data = new int[rows * cols];
+        if (src == nullptr) {
+            std::fill(data, data + rows * cols, 0);
+        } else {
+            std::copy(src, src + rows * cols, data);
+        }
+        return data;
+    }
+    void *addr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (addr == MAP_FAILED) throw std::bad_alloc();
+    int *data = static_cast<int *>(addr);
+    // fresh anonymous pages read as zero, so only src needs writing
+    auto touch = [&](const std::size_t &first, const std::size_t &last) {
+        char *begin = reinterpret_cast<char *>(data + first * cols),
+            *end = reinterpret_cast<char *>(data + last * cols);
+        if (src != nullptr) {
+            std::memcpy(begin, src + first * cols, end - begin);
+        } else {
+            long page = sysconf(_SC_PAGESIZE);
+            for (char *p = begin; p < end; p += page) {
+                *p = 0;
+            }
+        }
+    };
+
+    if (placement == PLACEMENT_INTERLEAVE && nodes() > 1) {
+        unsigned long mask = 0;
+        for (int id : node_ids_) {
+            if (id < 64) mask |= 1UL << id;
+        }
+        // best effort: without the policy this degrades to local placement
+        syscall(SYS_mbind, addr, bytes, MPOL_INTERLEAVE, &mask, 64, 0);
+    }
+    if (placement != PLACEMENT_FIRST_TOUCH || nodes() == 1) {
+        touch(0, rows);
+        return data;
+    }
+    std::vector<std::thread> threads;
+    for (int node = 0; node < nodes(); ++node) {
+        threads.emplace_back([&, node]() {
+            pin_node(node);
+            touch(first_row(node, rows), first_row(node + 1, rows));
+        });
+    }
+    for (std::thread &t : threads) {
+        t.join();
+    }
+    return data;
+}
+
+void NumaAlloc::release(int *data, const std::size_t &rows, const std::size_t &cols) {
+    if (data == nullptr) return;
+    std::size_t bytes = rows * cols * sizeof(int);
+    if (bytes < MIN_PLACED_BYTES) {
+        delete[] data;
+    } else {
+        munmap(data, bytes);
+    }
+}
+
+bool NumaAlloc::pin(const int &cpu) {
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+bool NumaAlloc::pin_node(const int &node) const {
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    for (int c : node_cpus_[node]) {
+        CPU_SET(c, &set);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
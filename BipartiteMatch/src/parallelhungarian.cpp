@@ -0,0 +1,236 @@
+/**
+ * parallelhungarian.cpp
+ * Shortest augmenting path form of the Hungarian algorithm,
+ * O(n^3), with each step's column sweep split over a thread team.
+ * Rows are added one at a time. Each step extends the search tree
+ * by the column of smallest slack and then relabels, and both are
+ * O(n) sweeps over the columns. Each thread owns a block of
+ * columns. In one pass over its block it applies the previous
+ * step's relabel and computes its smallest slack for the current
+ * step. The team then meets at a single barrier, after which every
+ * thread reduces the per-thread minima to the same winning column.
+ * Candidates are double buffered so that a thread running ahead
+ * can't overwrite a minimum another thread is still reading.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "numaalloc.h"
+#include "parallelhungarian.h"
+
+static const long long INF = std::numeric_limits<long long>::max() / 4;
+
+ParallelHungarian::ParallelHungarian(const int *weights, const int &len, const int &threads, 
+        const bool &pin) : len_(len), 
+        threads_(std::max(1, std::min(threads > 0 ? threads : 
+                static_cast<int>(std::thread::hardware_concurrency()), len + 1))), 
+        pin_(pin) {
+    // left untouched here so that each thread's block is placed near it
+    weights_ = new int[static_cast<std::size_t>(len_) * len_];
+    u_ = new long long[len_ + 1];
+    v_ = new long long[len_ + 1];
+    minv_ = new long long[len_ + 1];
+    p_ = new int[len_ + 1];
+    way_ = new int[len_ + 1];
+    used_ = new int[len_ + 1];
+    match_by_X_ = new int[len_];
+    candidates_ = new Candidate[threads_];
+    barrier_.arrived.store(0);
+    barrier_.generation.store(0);
+    std::fill(u_, u_ + len_ + 1, 0);
+    std::fill(v_, v_ + len_ + 1, 0);
+    std::fill(p_, p_ + len_ + 1, 0);
+    std::fill(way_, way_ + len_ + 1, 0);
+    std::fill(match_by_X_, match_by_X_ + len_, -1);
+    team([this, weights](const int &t) { copy_weights(t, weights); });
+}
+
+ParallelHungarian::~ParallelHungarian() {
+    delete[] weights_;
+    delete[] u_;
+    delete[] v_;
+    delete[] minv_;
+    delete[] p_;
+    delete[] way_;
+    delete[] used_;
+    delete[] match_by_X_;
+    delete[] candidates_;
+}
+
+template <class Task> void ParallelHungarian::team(const Task &task) {
+    std::vector<std::thread> workers;
+
+    for (int t = 1; t < threads_; ++t) {
+        workers.emplace_back([this, &task, t]() {
+            if (pin_) NumaAlloc::pin(NumaAlloc::system().cpu(t, threads_));
+            task(t);
+        });
+    }
+    task(0);
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+}
+
+int ParallelHungarian::first_col(const int &t) const {
+    return static_cast<long long>(len_ + 1) * t / threads_;
+}
+
+void ParallelHungarian::copy_weights(const int &t, const int *weights) {
+    int lo = std::max(first_col(t), 1) - 1,
+        hi = first_col(t + 1) - 1;
+
+    for (std::size_t i = 0; i < static_cast<std::size_t>(len_); ++i) {
+        std::copy(weights + i * len_ + lo, weights + i * len_ + hi, weights_ + i * len_ + lo);
+    }
+}
+
+void ParallelHungarian::init() {
+    team([this](const int &t) { solve(t); });
+    for (int j = 1; j <= len_; ++j) {
+        if (p_[j] > 0) match_by_X_[p_[j] - 1] = j - 1;
+    }
+}
+
+void ParallelHungarian::solve(const int &t) {
+    const int lo = first_col(t),
+        hi = first_col(t + 1);
+    long long delta, best, cur, ui0;
+    const int *row;
+    int parity = 0,
+        i, i0, j, j0, j1, s;
+
+    if (t == 0) p_[0] = 1;
+    wait();
+    for (i = 1; i <= len_; ++i) {
+        j0 = 0;
+        delta = 0;
+        for (j = lo; j < hi; ++j) {
+            minv_[j] = INF;
+            used_[j] = 0;
+        }
+        while (true) {
+            // p_[j0]'s label can't change in this pass: j0 isn't used yet
+            i0 = p_[j0];
+            ui0 = u_[i0];
+            // column j is row[j - 1]; column 0 is used from the start, never read
+            row = weights_ + static_cast<std::size_t>(i0 - 1) * len_;
+            best = INF;
+            j1 = -1;
+            for (j = lo; j < hi; ++j) {
+                if (j == j0) {
+                    minv_[j] -= delta;
+                    used_[j] = 1;
+                } else if (used_[j] == 1) {
+                    // relabel from the previous step
+                    u_[p_[j]] += delta;
+                    v_[j] -= delta;
+                } else {
+                    minv_[j] -= delta;
+                    cur = -row[j - 1] - ui0 - v_[j];
+                    if (cur < minv_[j]) {
+                        minv_[j] = cur;
+                        way_[j] = j0;
+                    }
+                    if (minv_[j] < best) {
+                        best = minv_[j];
+                        j1 = j;
+                    }
+                }
+            }
+            candidates_[t].slack[parity] = best;
+            candidates_[t].col[parity] = j1;
+            wait();
+            // every thread picks the same column, ties to the lowest
+            delta = INF;
+            j1 = -1;
+            for (s = 0; s < threads_; ++s) {
+                if (candidates_[s].col[parity] >= 0 && candidates_[s].slack[parity] < delta) {
+                    delta = candidates_[s].slack[parity];
+                    j1 = candidates_[s].col[parity];
+                }
+            }
+            parity ^= 1;
+            j0 = j1;
+            if (p_[j0] == 0) break;
+        }
+        // last relabel, then augment along way_ back to column 0
+        for (j = lo; j < hi; ++j) {
+            if (used_[j] == 1) {
+                u_[p_[j]] += delta;
+                v_[j] -= delta;
+            } else {
+                minv_[j] -= delta;
+            }
+        }
+        wait();
+        if (t == 0) {
+            do {
+                j1 = way_[j0];
+                p_[j0] = p_[j1];
+                j0 = j1;
+            } while (j0 != 0);
+            p_[0] = i + 1;
+        }
+        wait();
+    }
+}
+
+void ParallelHungarian::wait() {
+    if (threads_ == 1) return;
+    int generation = barrier_.generation.load(std::memory_order_acquire),
+        spins = 0;
+
+    if (barrier_.arrived.fetch_add(1, std::memory_order_acq_rel) == threads_ - 1) {
+        barrier_.arrived.store(0, std::memory_order_relaxed);
+        barrier_.generation.store(generation + 1, std::memory_order_release);
+        return;
+    }
+    while (barrier_.generation.load(std::memory_order_acquire) == generation) {
+        if (++spins < 1024) {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#endif
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+long long ParallelHungarian::get_match_total() const {
+    long long total = 0;
+
+    for (int x = 0; x < len_; ++x) {
+        if (matchX(x) >= 0) total += weight(x, matchX(x));
+    }
+    return total;
+}
+
+int ParallelHungarian::matchX(const int &x) const {
+    return match_by_X_[x];
+}
+
+int ParallelHungarian::matchY(const int &y) const {
+    return p_[y + 1] - 1;
+}
+
+int ParallelHungarian::length() const {
+    return len_;
+}
+
+int ParallelHungarian::threads() const {
+    return threads_;
+}
+
+int ParallelHungarian::weight(const int &x, const int &y) const {
+    return weights_[static_cast<std::size_t>(x) * len_ + y];
+}
@@ -0,0 +1,241 @@
+/**
+ * reduction.cpp
+ * Pre-pass for Hungarian:
+ * 1. Column reduction: after labelling each X vertex with its
+ *    row maximum, lower each Y label to the largest
+ *    weight - labelX in its column. The labels stay feasible
+ *    and every column gets a tight edge.
+ * 2. Pruning: with U the label total and P the weight of a greedy
+ *    matching, an optimal matching has U - OPT <= U - P, and its
+ *    edges' slacks labelX + labelY - weight sum to U - OPT.
+ *    So an edge whose slack exceeds U - P is in no optimal matching.
+ * 3. Forcing: an X or Y vertex with a single remaining allowed
+ *    edge is matched along it, which may leave further vertices
+ *    with a single allowed edge.
+ * The unmatched rest is solved by Hungarian from the reduced
+ * labels. Pruned edges keep their weights there, since no
+ * optimal matching uses them anyway.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "hungarian.h"
+#include "index.h"
+#include "reduction.h"
+
+Reduction::Reduction(const int *weights, const int &rows, const int &cols) : 
+        rows_(rows), cols_(cols), transposed_(rows > cols), len_(std::max(rows, cols)), 
+        index_(len_), reduced_len_(len_), forced_(0), pruned_(0) {
+    int realX = transposed_ ? cols_ : rows_,
+        i, j;
+    Index input(cols_);
+
+    std::size_t cells = static_cast<std::size_t>(len_) * len_;
+
+    weights_ = new int[cells];
+    std::fill(weights_, weights_ + cells, 0);
+    for (i = 0; i < realX; ++i) {
+        for (j = 0; j < len_; ++j) {
+            weights_[index_.index(i, j)] = transposed_ ? weights[input.index(j, i)] : 
+                weights[input.index(i, j)];
+        }
+    }
+    labelsX_ = new int[len_];
+    labelsY_ = new int[len_];
+    allowed_ = new int[cells];
+    matchX_ = new int[len_];
+    matchY_ = new int[len_];
+    std::fill(matchX_, matchX_ + len_, -1);
+    std::fill(matchY_, matchY_ + len_, -1);
+}
+
+Reduction::~Reduction() {
+    delete[] weights_;
+    delete[] labelsX_;
+    delete[] labelsY_;
+    delete[] allowed_;
+    delete[] matchX_;
+    delete[] matchY_;
+}
+
+void Reduction::init() {
+    int dual_total = 0;
+
+    reduce_labels();
+    for (int i = 0; i < len_; ++i) {
+        dual_total += labelsX_[i] + labelsY_[i];
+    }
+    prune(dual_total - greedy_total());
+    force();
+    solve_rest();
+}
+
+void Reduction::reduce_labels() {
+    int i, j;
+
+    for (i = 0; i < len_; ++i) {
+        labelsX_[i] = *std::max_element(weights_ + index_.index(i, 0), 
+                weights_ + index_.index(i + 1, 0));
+    }
+    for (j = 0; j < len_; ++j) {
+        labelsY_[j] = weights_[index_.index(0, j)] - labelsX_[0];
+        for (i = 1; i < len_; ++i) {
+            labelsY_[j] = std::max(labelsY_[j], weights_[index_.index(i, j)] - labelsX_[i]);
+        }
+    }
+}
+
+/**
+ * weight of the matching that gives each X vertex in turn
+ * its heaviest free Y vertex
+ */
+int Reduction::greedy_total() const {
+    std::vector<bool> taken(len_, false);
+    int total = 0,
+        best,
+        i, j;
+
+    for (i = 0; i < len_; ++i) {
+        best = -1;
+        for (j = 0; j < len_; ++j) {
+            if (!taken[j] && (best < 0 || weights_[index_.index(i, j)] > weights_[index_.index(i, best)])) {
+                best = j;
+            }
+        }
+        taken[best] = true;
+        total += weights_[index_.index(i, best)];
+    }
+    return total;
+}
+
+void Reduction::prune(const int &gap) {
+    int i, j;
+
+    for (i = 0; i < len_; ++i) {
+        for (j = 0; j < len_; ++j) {
+            if (labelsX_[i] + labelsY_[j] - weights_[index_.index(i, j)] <= gap) {
+                allowed_[index_.index(i, j)] = 1;
+            } else {
+                allowed_[index_.index(i, j)] = 0;
+                ++pruned_;
+            }
+        }
+    }
+}
+
+void Reduction::force() {
+    std::vector<int> degreeX(len_, 0), degreeY(len_, 0),
+        // X vertex x is pushed as x, Y vertex y as len_ + y
+        single;
+    int i, j, v;
+
+    for (i = 0; i < len_; ++i) {
+        for (j = 0; j < len_; ++j) {
+            degreeX[i] += allowed_[index_.index(i, j)];
+            degreeY[j] += allowed_[index_.index(i, j)];
+        }
+    }
+    for (v = 0; v < len_; ++v) {
+        if (degreeX[v] == 1) single.push_back(v);
+        if (degreeY[v] == 1) single.push_back(len_ + v);
+    }
+    auto match = [&](const int &x, const int &y) {
+        matchX_[x] = y;
+        matchY_[y] = x;
+        ++forced_;
+        --reduced_len_;
+        // x and y no longer count towards their neighbors' degrees
+        for (int k = 0; k < len_; ++k) {
+            if (k != y && matchY_[k] < 0 && allowed_[index_.index(x, k)] == 1 && --degreeY[k] == 1) {
+                single.push_back(len_ + k);
+            }
+            if (k != x && matchX_[k] < 0 && allowed_[index_.index(k, y)] == 1 && --degreeX[k] == 1) {
+                single.push_back(k);
+            }
+        }
+    };
+    while (!single.empty()) {
+        v = single.back();
+        single.pop_back();
+        if (v < len_) {
+            if (matchX_[v] >= 0 || degreeX[v] != 1) continue;
+            for (j = 0; matchY_[j] >= 0 || allowed_[index_.index(v, j)] == 0; ++j) {}
+            match(v, j);
+        } else {
+            v -= len_;
+            if (matchY_[v] >= 0 || degreeY[v] != 1) continue;
+            for (i = 0; matchX_[i] >= 0 || allowed_[index_.index(i, v)] == 0; ++i) {}
+            match(i, v);
+        }
+    }
+}
+
+void Reduction::solve_rest() {
+    if (reduced_len_ == 0) return;
+    std::vector<int> restX, restY, weights, labelsX, labelsY;
+    int i, j;
+
+    for (i = 0; i < len_; ++i) {
+        if (matchX_[i] < 0) restX.push_back(i);
+        if (matchY_[i] < 0) restY.push_back(i);
+    }
+    for (int x : restX) {
+        labelsX.push_back(labelsX_[x]);
+        for (int y : restY) {
+            weights.push_back(weights_[index_.index(x, y)]);
+        }
+    }
+    for (int y : restY) {
+        labelsY.push_back(labelsY_[y]);
+    }
+    Hungarian hung(weights.data(), reduced_len_, labelsX.data(), labelsY.data());
+    hung.init();
+    for (i = 0; i < reduced_len_; ++i) {
+        j = hung.matchX(i);
+        matchX_[restX[i]] = restY[j];
+        matchY_[restY[j]] = restX[i];
+    }
+}
+
+int Reduction::get_match_total() const {
+    int realX = transposed_ ? cols_ : rows_,
+        total = 0;
+
+    for (int i = 0; i < realX; ++i) {
+        if (matchX_[i] >= 0) total += weights_[index_.index(i, matchX_[i])];
+    }
+    return total;
+}
+
+int Reduction::matchX(const int &x) const {
+    if (!transposed_) return matchX_[x];
+    return matchY_[x] < cols_ ? matchY_[x] : -1;
+}
+
+int Reduction::matchY(const int &y) const {
+    if (transposed_) return matchX_[y];
+    return matchY_[y] < rows_ ? matchY_[y] : -1;
+}
+
+int Reduction::length() const {
+    return len_;
+}
+
+int Reduction::reduced_length() const {
+    return reduced_len_;
+}
+
+int Reduction::forced() const {
+    return forced_;
+}
+
+int Reduction::pruned() const {
+    return pruned_;
+}
@@ -0,0 +1,192 @@
+/**
+ * reorder.cpp
+ * Vertex renumbering before maximum matching.
+ * MaxMatch stores the graph as a dense row-major matrix and
+ * dfs_visit scans each row contiguously whatever the numbering,
+ * so renumbering does not change cache behaviour. What it
+ * changes is the order in which each pass of dfs() tries the free
+ * X vertices, and the order of columns within a row. The
+ * renumbered graph is written straight into the matcher.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "index.h"
+#include "maxmatch.h"
+#include "reorder.h"
+
+Reorder::Reorder(const int *graph, const int &rows, const int &cols, const Order &order) : 
+        rows_(rows), cols_(cols), order_(order) {
+    Index index(cols_);
+    int i, j;
+
+    newX_ = new int[rows_];
+    newY_ = new int[cols_];
+    oldX_ = new int[rows_];
+    oldY_ = new int[cols_];
+    switch (order_) {
+    case ORDER_DEGREE:
+        number_by_degree(graph);
+        break;
+    case ORDER_RCM:
+        number_by_rcm(graph);
+        break;
+    default:
+        std::iota(oldX_, oldX_ + rows_, 0);
+        std::iota(oldY_, oldY_ + cols_, 0);
+    }
+    for (i = 0; i < rows_; ++i) {
+        newX_[oldX_[i]] = i;
+    }
+    for (j = 0; j < cols_; ++j) {
+        newY_[oldY_[j]] = j;
+    }
+    // renumber straight into the matcher, without a second dense copy
+    matcher_ = new MaxMatch(rows_, cols_);
+    for (i = 0; i < rows_; ++i) {
+        for (j = 0; j < cols_; ++j) {
+            if (graph[index.index(i, j)] != 0) matcher_->add_graph_edge(newX_[i], newY_[j]);
+        }
+    }
+}
+
+Reorder::~Reorder() {
+    delete matcher_;
+    delete[] newX_;
+    delete[] newY_;
+    delete[] oldX_;
+    delete[] oldY_;
+}
+
+void Reorder::number_by_degree(const int *graph) {
+    std::vector<int> degreeX(rows_, 0), degreeY(cols_, 0);
+    Index index(cols_);
+
+    for (int i = 0; i < rows_; ++i) {
+        for (int j = 0; j < cols_; ++j) {
+            if (graph[index.index(i, j)] != 0) {
+                ++degreeX[i];
+                ++degreeY[j];
+            }
+        }
+    }
+    std::iota(oldX_, oldX_ + rows_, 0);
+    std::iota(oldY_, oldY_ + cols_, 0);
+    std::stable_sort(oldX_, oldX_ + rows_, [&](const int &a, const int &b) {
+        return degreeX[a] < degreeX[b];
+    });
+    std::stable_sort(oldY_, oldY_ + cols_, [&](const int &a, const int &b) {
+        return degreeY[a] < degreeY[b];
+    });
+}
+
+void Reorder::number_by_rcm(const int *graph) {
+    const int vertices = rows_ + cols_;
+    std::vector<int> degree(vertices, 0), order, neighbors, start(vertices);
+    std::vector<bool> seen(vertices, false);
+    Index index(cols_);
+    int i, j, v, countX = 0, countY = 0;
+
+    for (i = 0; i < rows_; ++i) {
+        for (j = 0; j < cols_; ++j) {
+            if (graph[index.index(i, j)] != 0) {
+                ++degree[i];
+                ++degree[rows_ + j];
+            }
+        }
+    }
+    /**
+     * adjacency lists of both sides, filled in one pass in row order,
+     * so the search does not rescan the matrix or scan it by columns.
+     * Neighbors of vertex v are adj[first[v]] .. adj[first[v + 1] - 1]
+     */
+    std::vector<std::size_t> first(vertices + 1, 0);
+    for (v = 0; v < vertices; ++v) {
+        first[v + 1] = first[v] + degree[v];
+    }
+    std::vector<int> adj(first[vertices]);
+    std::vector<std::size_t> end(first.begin(), first.end() - 1);
+    for (i = 0; i < rows_; ++i) {
+        for (j = 0; j < cols_; ++j) {
+            if (graph[index.index(i, j)] != 0) {
+                adj[end[i]++] = rows_ + j;
+                adj[end[rows_ + j]++] = i;
+            }
+        }
+    }
+    // components are started from their lowest degree vertex
+    std::iota(start.begin(), start.end(), 0);
+    std::stable_sort(start.begin(), start.end(), [&](const int &a, const int &b) {
+        return degree[a] < degree[b];
+    });
+    order.reserve(vertices);
+    for (int s : start) {
+        if (seen[s]) continue;
+        seen[s] = true;
+        order.push_back(s);
+        for (std::size_t head = order.size() - 1; head < order.size(); ++head) {
+            v = order[head];
+            neighbors.clear();
+            for (std::size_t k = first[v]; k < first[v + 1]; ++k) {
+                if (!seen[adj[k]]) neighbors.push_back(adj[k]);
+            }
+            std::stable_sort(neighbors.begin(), neighbors.end(), [&](const int &a, const int &b) {
+                return degree[a] < degree[b];
+            });
+            for (int w : neighbors) {
+                seen[w] = true;
+                order.push_back(w);
+            }
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    for (int w : order) {
+        if (w < rows_) {
+            oldX_[countX++] = w;
+        } else {
+            oldY_[countY++] = w - rows_;
+        }
+    }
+}
+
+void Reorder::init() {
+    matcher_->init();
+}
+
+int Reorder::match_X(const int &x) const {
+    int y = matcher_->match_X(newX_[x]);
+    return y < 0 ? -1 : oldY_[y];
+}
+
+int Reorder::match_Y(const int &y) const {
+    int x = matcher_->match_Y(newY_[y]);
+    return x < 0 ? -1 : oldX_[x];
+}
+
+int Reorder::matches() const {
+    return matcher_->matches();
+}
+
+int Reorder::new_X(const int &x) const {
+    return newX_[x];
+}
+
+int Reorder::new_Y(const int &y) const {
+    return newY_[y];
+}
+
+int Reorder::sizeX() const {
+    return rows_;
+}
+
+int Reorder::sizeY() const {
+    return cols_;
+}
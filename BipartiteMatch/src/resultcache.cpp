@@ -0,0 +1,189 @@
+/**
+ * resultcache.cpp
+ * Hungarian results cached by weight matrix hash and
+ * reused after an O(n^2) check of the stored labels.
+ * On a miss the labels of the most recent result of the same
+ * size, kept first in a list of keys per size, seed Hungarian. labelsY is kept and each labelsX[x]
+ * lowered or raised to max over y of weight(x, y) - labelsY[y],
+ * the least value that keeps row x feasible, so a small change
+ * to the weights leaves most of the old equality graph tight.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "hungarian.h"
+#include "index.h"
+#include "resultcache.h"
+
+ResultCache::ResultCache(const std::size_t &max_bytes) : max_bytes_(max_bytes), bytes_(0), 
+        hits_(0), misses_(0), rejected_(0), warm_starts_(0), evictions_(0) {}
+
+int ResultCache::solve(const int *weights, const int &len, int *matchX) {
+    unsigned long long key = hash(weights, len);
+    auto found = index_.find(key);
+    Index index(len);
+    int total = 0,
+        i;
+
+    if (found != index_.end()) {
+        Entry &entry = *found->second;
+        if (entry.len == len && verify(weights, len, entry.matchX.data(), 
+                    entry.labelsX.data(), entry.labelsY.data())) {
+            ++hits_;
+            touch(found->second);
+            for (i = 0; i < len; ++i) {
+                matchX[i] = entry.matchX[i];
+                total += weights[index.index(i, matchX[i])];
+            }
+            return total;
+        }
+        ++rejected_;
+        erase(found->second);
+    }
+    ++misses_;
+    auto similar = latest(len);
+    std::vector<int> labelsX, labelsY;
+    if (similar != entries_.end()) {
+        ++warm_starts_;
+        labelsY = similar->labelsY;
+        labelsX.resize(len);
+        for (i = 0; i < len; ++i) {
+            const int *row = weights + index.index(i, 0);
+            labelsX[i] = row[0] - labelsY[0];
+            for (int j = 1; j < len; ++j) {
+                labelsX[i] = std::max(labelsX[i], row[j] - labelsY[j]);
+            }
+        }
+    }
+    Hungarian hung(weights, len, labelsX.empty() ? nullptr : labelsX.data(), 
+            labelsY.empty() ? nullptr : labelsY.data());
+    Entry entry;
+    hung.init();
+    entry.len = len;
+    entry.matchX.resize(len);
+    entry.labelsX.resize(len);
+    entry.labelsY.resize(len);
+    for (i = 0; i < len; ++i) {
+        matchX[i] = entry.matchX[i] = hung.matchX(i);
+        entry.labelsX[i] = hung.labelX(i);
+        entry.labelsY[i] = hung.labelY(i);
+    }
+    insert(key, entry);
+    return hung.get_match_total();
+}
+
+bool ResultCache::verify(const int *weights, const int &len, const int *matchX, 
+        const int *labelsX, const int *labelsY) {
+    std::vector<bool> matchedY(len, false);
+    Index index(len);
+    int i, j;
+
+    for (i = 0; i < len; ++i) {
+        if (matchX[i] < 0 || matchX[i] >= len || matchedY[matchX[i]]) return false;
+        matchedY[matchX[i]] = true;
+        if (static_cast<long long>(labelsX[i]) + labelsY[matchX[i]] != 
+                weights[index.index(i, matchX[i])]) return false;
+    }
+    for (i = 0; i < len; ++i) {
+        const int *row = weights + index.index(i, 0);
+        for (j = 0; j < len; ++j) {
+            if (static_cast<long long>(labelsX[i]) + labelsY[j] < row[j]) return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * 64-bit multiply-xorshift over the matrix, one int at a time
+ */
+unsigned long long ResultCache::hash(const int *weights, const int &len) {
+    const unsigned long long prime = 0x9e3779b97f4a7c15ULL;
+    unsigned long long h = static_cast<unsigned long long>(len) * prime;
+    std::size_t cells = static_cast<std::size_t>(len) * len;
+
+    for (std::size_t k = 0; k < cells; ++k) {
+        h = (h ^ static_cast<unsigned int>(weights[k])) * prime;
+        h ^= h >> 32;
+    }
+    return h;
+}
+
+void ResultCache::insert(const unsigned long long &key, Entry &entry) {
+    entry.key = key;
+    entry.bytes = sizeof(Entry) + 3 * entry.len * sizeof(int) + 
+        sizeof(std::pair<unsigned long long, std::list<Entry>::iterator>) + 
+        sizeof(unsigned long long);
+    // a result larger than the whole cache is not kept
+    if (entry.bytes > max_bytes_) return;
+    while (bytes_ + entry.bytes > max_bytes_) {
+        ++evictions_;
+        erase(std::prev(entries_.end()));
+    }
+    bytes_ += entry.bytes;
+    std::list<unsigned long long> &keys = by_len_[entry.len];
+    keys.push_front(key);
+    entry.same_len = keys.begin();
+    entries_.push_front(std::move(entry));
+    index_[key] = entries_.begin();
+}
+
+void ResultCache::erase(const std::list<Entry>::iterator &it) {
+    auto keys = by_len_.find(it->len);
+
+    keys->second.erase(it->same_len);
+    if (keys->second.empty()) by_len_.erase(keys);
+    bytes_ -= it->bytes;
+    index_.erase(it->key);
+    entries_.erase(it);
+}
+
+void ResultCache::touch(const std::list<Entry>::iterator &it) {
+    std::list<unsigned long long> &keys = by_len_[it->len];
+
+    keys.splice(keys.begin(), keys, it->same_len);
+    entries_.splice(entries_.begin(), entries_, it);
+}
+
+std::list<ResultCache::Entry>::iterator ResultCache::latest(const int &len) {
+    auto keys = by_len_.find(len);
+
+    if (keys == by_len_.end()) return entries_.end();
+    return index_[keys->second.front()];
+}
+
+std::size_t ResultCache::hits() const {
+    return hits_;
+}
+
+std::size_t ResultCache::misses() const {
+    return misses_;
+}
+
+std::size_t ResultCache::rejected() const {
+    return rejected_;
+}
+
+std::size_t ResultCache::warm_starts() const {
+    return warm_starts_;
+}
+
+std::size_t ResultCache::evictions() const {
+    return evictions_;
+}
+
+std::size_t ResultCache::bytes() const {
+    return bytes_;
+}
+
+std::size_t ResultCache::size() const {
+    return entries_.size();
+}
@@ -0,0 +1,230 @@
+/**
+ * shmring.cpp
+ * Lock-free ring of request slots in POSIX shared memory.
+ * Clients and server workers claim tickets with a single
+ * atomic increment or compare-and-swap and hand slots over
+ * through the slot sequence numbers, as in Vyukov's bounded
+ * MPMC queue.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "shmring.h"
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "shared memory atomics must be lock-free");
+
+ShmRing::ShmRing(const char *name, const int &slots, const int &max_len) : owner_(true) {
+    if (slots < 3) throw std::invalid_argument("ShmRing needs at least 3 slots");
+    std::strncpy(name_, name, sizeof(name_) - 1);
+    name_[sizeof(name_) - 1] = '\0';
+    std::size_t payload = (static_cast<std::size_t>(max_len) * max_len + max_len) * sizeof(int),
+        slot_bytes = (sizeof(Slot) + payload + 63) / 64 * 64,
+        header_bytes = (sizeof(Header) + 63) / 64 * 64;
+
+    // never take over the segment of a live ring with the same name
+    int fd = shm_open(name_, O_CREAT | O_RDWR | O_EXCL, 0600);
+    if (fd < 0 && errno == EEXIST) {
+        throw std::runtime_error(std::string("solver ring already exists: ") + name_ + 
+                " (remove it from /dev/shm if no daemon is using it)");
+    }
+    if (fd < 0) throw std::runtime_error(std::string("shm_open failed for ") + name_);
+    if (ftruncate(fd, header_bytes + slot_bytes * slots) != 0) {
+        close(fd);
+        shm_unlink(name_);
+        throw std::runtime_error(std::string("ftruncate failed for ") + name_);
+    }
+    map(fd, header_bytes + slot_bytes * slots);
+    header_ = new (header_) Header;
+    header_->slots = slots;
+    header_->max_len = max_len;
+    header_->slot_bytes = slot_bytes;
+    header_->stop.store(0);
+    header_->head.store(0);
+    header_->tail.store(0);
+    for (int i = 0; i < slots; ++i) {
+        Slot *s = new (slots_ + slot_bytes * i) Slot;
+        s->seq.store(i);
+        s->abandoned.store(0);
+    }
+    // publish the layout last, attaching clients check it
+    std::atomic_thread_fence(std::memory_order_release);
+    header_->magic = MAGIC;
+}
+
+ShmRing::ShmRing(const char *name) : owner_(false) {
+    struct stat st;
+
+    std::strncpy(name_, name, sizeof(name_) - 1);
+    name_[sizeof(name_) - 1] = '\0';
+    int fd = shm_open(name_, O_RDWR, 0600);
+    if (fd < 0) throw std::runtime_error(std::string("no solver ring named ") + name_);
+    if (fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(Header)) {
+        close(fd);
+        throw std::runtime_error(std::string("solver ring not initialized: ") + name_);
+    }
+    map(fd, st.st_size);
+    if (header_->magic != MAGIC) {
+        munmap(header_, bytes_);
+        throw std::runtime_error(std::string("not a solver ring: ") + name_);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    // the slot offsets come from the segment, check them against its size
+    std::size_t payload = (static_cast<std::size_t>(header_->max_len) * header_->max_len + 
+            header_->max_len) * sizeof(int),
+        header_bytes = (sizeof(Header) + 63) / 64 * 64;
+    if (header_->slots < 3 || header_->max_len < 1 || 
+            header_->slot_bytes != (sizeof(Slot) + payload + 63) / 64 * 64 ||
+            bytes_ != header_bytes + header_->slot_bytes * header_->slots) {
+        munmap(header_, bytes_);
+        throw std::runtime_error(std::string("solver ring has a bad layout: ") + name_);
+    }
+}
+
+ShmRing::~ShmRing() {
+    munmap(header_, bytes_);
+    if (owner_) shm_unlink(name_);
+}
+
+void ShmRing::map(const int &fd, const std::size_t &bytes) {
+    void *addr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    close(fd);
+    if (addr == MAP_FAILED) throw std::runtime_error(std::string("mmap failed for ") + name_);
+    bytes_ = bytes;
+    header_ = static_cast<Header *>(addr);
+    slots_ = static_cast<char *>(addr) + (sizeof(Header) + 63) / 64 * 64;
+}
+
+int ShmRing::slots() const {
+    return header_->slots;
+}
+
+int ShmRing::max_len() const {
+    return header_->max_len;
+}
+
+ShmRing::Slot &ShmRing::slot(const unsigned long long &ticket) const {
+    return *reinterpret_cast<Slot *>(slots_ + header_->slot_bytes * (ticket % header_->slots));
+}
+
+int *ShmRing::matrix(const unsigned long long &ticket) const {
+    return reinterpret_cast<int *>(&slot(ticket) + 1);
+}
+
+int *ShmRing::match(const unsigned long long &ticket) const {
+    return matrix(ticket) + static_cast<std::size_t>(header_->max_len) * header_->max_len;
+}
+
+bool ShmRing::acquire(unsigned long long &ticket, 
+        const std::chrono::steady_clock::time_point &deadline) {
+    unsigned long long head = header_->head.load(std::memory_order_relaxed),
+        seq;
+    int spins = 0;
+
+    while (true) {
+        seq = slot(head).seq.load(std::memory_order_acquire);
+        if (seq == head) {
+            if (header_->head.compare_exchange_weak(head, head + 1, std::memory_order_relaxed)) {
+                ticket = head;
+                slot(ticket).abandoned.store(0, std::memory_order_relaxed);
+                return true;
+            }
+        } else if (seq < head) {
+            // ring full
+            if (stopped() || std::chrono::steady_clock::now() >= deadline) return false;
+            backoff(spins);
+            head = header_->head.load(std::memory_order_relaxed);
+        } else {
+            // another client took this ticket
+            head = header_->head.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void ShmRing::submit(const unsigned long long &ticket) {
+    slot(ticket).seq.store(ticket + 1, std::memory_order_release);
+}
+
+bool ShmRing::wait(const unsigned long long &ticket, 
+        const std::chrono::steady_clock::time_point &deadline) {
+    Slot &s = slot(ticket);
+    int spins = 0;
+
+    while (s.seq.load(std::memory_order_acquire) != ticket + 2) {
+        if (stopped() || std::chrono::steady_clock::now() >= deadline) {
+            // the server hasn't reached complete(), it releases the slot
+            if (s.abandoned.exchange(1, std::memory_order_acq_rel) == 0) return false;
+            // the server is publishing the result
+            while (s.seq.load(std::memory_order_acquire) != ticket + 2) {
+                backoff(spins);
+            }
+            return true;
+        }
+        backoff(spins);
+    }
+    return true;
+}
+
+void ShmRing::release(const unsigned long long &ticket) {
+    slot(ticket).seq.store(ticket + header_->slots, std::memory_order_release);
+}
+
+bool ShmRing::take(unsigned long long &ticket) {
+    unsigned long long tail = header_->tail.load(std::memory_order_relaxed);
+
+    while (slot(tail).seq.load(std::memory_order_acquire) == tail + 1) {
+        if (header_->tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+            ticket = tail;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ShmRing::complete(const unsigned long long &ticket) {
+    Slot &s = slot(ticket);
+
+    if (s.abandoned.exchange(1, std::memory_order_acq_rel) == 0) {
+        s.seq.store(ticket + 2, std::memory_order_release);
+    } else {
+        s.seq.store(ticket + header_->slots, std::memory_order_release);
+    }
+}
+
+void ShmRing::request_stop() {
+    header_->stop.store(1, std::memory_order_release);
+}
+
+bool ShmRing::stopped() const {
+    return header_->stop.load(std::memory_order_acquire) != 0;
+}
+
+/**
+ * spin briefly, then yield the core so that waiting
+ * clients don't starve the server workers
+ */
+void ShmRing::backoff(int &spins) {
+    if (++spins < 64) {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+    } else {
+        std::this_thread::yield();
+    }
+}
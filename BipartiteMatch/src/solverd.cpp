@@ -0,0 +1,168 @@
+/**
+ * solverd.cpp
+ * Solver daemon serving local clients through a ShmRing.
+ * Worker threads claim up to batch submitted requests at a
+ * time and solve each in place with Hungarian (weights,
+ * square) or MaxMatch (0/1 adjacency), writing the X matches
+ * and the total weight or match count back into the slot.
+ * Each worker keeps one warm solver of each kind, so after
+ * the largest request size has been seen solving allocates
+ * nothing.
+ * A KIND_SHUTDOWN request, SIGINT or SIGTERM stops the daemon.
+ * Requests submitted but not yet taken when it stops are
+ * completed with STATUS_STOPPED.
+ *
+ * usage: solverd name [slots] [max_len] [threads] [batch] [pin]
+ * A worker takes up to batch requests per pass over the ring
+ * (default 1) and solves them one after another, so batch > 1
+ * saves ring operations at the cost of latency: a burst of up
+ * to batch requests can be serialized on one worker while the
+ * others are idle.
+ * A nonzero pin pins worker i to NumaAlloc::cpu(i, threads).
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "hungarian.h"
+#include "maxmatch.h"
+#include "numaalloc.h"
+#include "shmring.h"
+
+static ShmRing *ring = nullptr;
+
+void serve(ShmRing &, const int &, const int &);
+void solve(ShmRing &, const unsigned long long &);
+void handle_signal(int);
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " name [slots] [max_len] [threads] [batch] [pin]" << std::endl;
+        return 1;
+    }
+    int slots = argc > 2 ? std::atoi(argv[2]) : 64,
+        max_len = argc > 3 ? std::atoi(argv[3]) : 512,
+        threads = argc > 4 ? std::atoi(argv[4]) : std::thread::hardware_concurrency(),
+        batch = argc > 5 ? std::atoi(argv[5]) : 1;
+    bool pin = argc > 6 && std::atoi(argv[6]) != 0;
+
+    try {
+        ShmRing server_ring(argv[1], slots, max_len);
+        std::vector<std::thread> workers;
+
+        ring = &server_ring;
+        std::signal(SIGINT, handle_signal);
+        std::signal(SIGTERM, handle_signal);
+        std::cout << "solverd: serving " << argv[1] << " with " << threads << " workers, " 
+            << slots << " slots, matrices up to " << max_len << " x " << max_len << std::endl;
+        threads = std::max(threads, 1);
+        for (int i = 0; i < threads; ++i) {
+            workers.emplace_back(serve, std::ref(server_ring), std::max(batch, 1), 
+                    pin ? NumaAlloc::system().cpu(i, threads) : -1);
+        }
+        for (std::thread &worker : workers) {
+            worker.join();
+        }
+        ring = nullptr;
+        // no client is left waiting for a request nobody will take
+        unsigned long long ticket;
+        while (server_ring.take(ticket)) {
+            server_ring.slot(ticket).status = ShmRing::STATUS_STOPPED;
+            server_ring.slot(ticket).total = 0;
+            server_ring.complete(ticket);
+        }
+    } catch (const std::exception &e) {
+        std::cerr << "solverd: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * worker loop, pinned to cpu unless it is negative
+ */
+void serve(ShmRing &server_ring, const int &batch, const int &cpu) {
+    std::vector<unsigned long long> tickets;
+    unsigned long long ticket;
+    int idle = 0;
+
+    if (cpu >= 0) NumaAlloc::pin(cpu);
+    tickets.reserve(batch);
+    while (!server_ring.stopped()) {
+        tickets.clear();
+        while (static_cast<int>(tickets.size()) < batch && server_ring.take(ticket)) {
+            tickets.push_back(ticket);
+        }
+        if (tickets.empty()) {
+            // stay hot for a while, then stop burning the core
+            if (++idle < 1024) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+            continue;
+        }
+        idle = 0;
+        for (unsigned long long t : tickets) {
+            solve(server_ring, t);
+            server_ring.complete(t);
+        }
+    }
+}
+
+/**
+ * the solvers read the problem straight from the slot
+ */
+void solve(ShmRing &server_ring, const unsigned long long &ticket) {
+    // grown to the largest request this worker has solved
+    static thread_local Hungarian hung(nullptr, 0);
+    static thread_local MaxMatch mm(nullptr, 0, 0);
+    ShmRing::Slot &slot = server_ring.slot(ticket);
+    int *match = server_ring.match(ticket),
+        i;
+
+    slot.status = ShmRing::STATUS_OK;
+    slot.total = 0;
+    if (slot.kind == ShmRing::KIND_SHUTDOWN) {
+        server_ring.request_stop();
+        return;
+    }
+    if (slot.rows < 1 || slot.cols < 1 || slot.rows > server_ring.max_len() || 
+            slot.cols > server_ring.max_len()) {
+        slot.status = ShmRing::STATUS_INVALID;
+        return;
+    }
+    if (slot.kind == ShmRing::KIND_HUNGARIAN && slot.rows == slot.cols) {
+        hung.reassign(server_ring.matrix(ticket), slot.rows);
+        hung.init();
+        for (i = 0; i < slot.rows; ++i) {
+            match[i] = hung.matchX(i);
+        }
+        slot.total = hung.get_match_total();
+    } else if (slot.kind == ShmRing::KIND_MAXMATCH) {
+        mm.reassign(server_ring.matrix(ticket), slot.rows, slot.cols);
+        mm.init();
+        for (i = 0; i < slot.rows; ++i) {
+            match[i] = mm.match_X(i);
+        }
+        slot.total = mm.matches();
+    } else {
+        slot.status = ShmRing::STATUS_INVALID;
+    }
+}
+
+void handle_signal(int) {
+    if (ring != nullptr) ring->request_stop();
+}
@@ -0,0 +1,167 @@
+/**
+ * bottleneck_test.cpp
+ * Test suite for bottleneck assignment, checked against
+ * brute force over all permutations.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "bottleneck.h"
+#include "index.h"
+#include "maxmatch.h"
+
+#define RESET "\033[0m"
+#define BOLDRED "\033[1m\033[31m"
+
+void test(const char *, const int *, const int &);
+void test_random(const int &, const int &, const unsigned &);
+void test_far_bound(const int &, const unsigned &);
+int brute_force(const int *, const int &);
+void check(const bool &, const char *, int &, int &);
+
+int main() {
+    int weights1[] = {
+        1, 6, 0,
+        0, 8, 6,
+        4, 0, 1
+    };
+    test("Test case 1", weights1, 3);
+
+    int weights3[] = {
+        8, 15, 54, 32,
+        50, 19, 9, 98,
+        50, 79, 80, 30,
+        76, 86, 85, 48
+    };
+    test("Test case 3", weights3, 4);
+
+    for (unsigned seed = 1; seed <= 5; ++seed) {
+        test_random(7, 20, seed);
+    }
+    test_random(8, 1000, 6);
+    test_far_bound(60, 7);
+
+    return 0;
+}
+
+void test(const char *msg, const int *weights, const int &len) {
+    std::cout << msg << std::endl;
+    int passed = 0,
+        failed = 0,
+        largest = 0,
+        i;
+    Index index(len);
+    Bottleneck bot(weights, len);
+    std::vector<bool> usedY(len, false);
+
+    bot.init();
+    check(bot.threshold() == brute_force(weights, len), "Incorrect bottleneck value!", passed, failed);
+    for (i = 0; i < len; ++i) {
+        if (bot.matchX(i) < 0 || usedY[bot.matchX(i)]) break;
+        usedY[bot.matchX(i)] = true;
+        largest = std::max(largest, weights[index.index(i, bot.matchX(i))]);
+    }
+    check(i == len, "Matching not perfect!", passed, failed);
+    check(largest == bot.threshold(), "Largest matched weight differs from threshold!", passed, failed);
+    check(bot.probes() <= len * len, "Too many threshold probes!", passed, failed);
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << (failed > 0 ? BOLDRED : RESET) << failed << " tests failed" << RESET << std::endl << std::endl;
+}
+
+void test_random(const int &len, const int &max_weight, const unsigned &seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, max_weight);
+    std::vector<int> weights(len * len);
+
+    for (int &w : weights) {
+        w = dist(gen);
+    }
+    test("Random weights", weights.data(), len);
+}
+
+/**
+ * a cheap first row and column keep the row and column minima
+ * far below the bottleneck, with thousands of distinct weights
+ * in between. Too large for brute force, so the threshold is
+ * checked with MaxMatch below it.
+ */
+void test_far_bound(const int &len, const unsigned &seed) {
+    std::cout << "Lower bound far below the bottleneck" << std::endl;
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, 1000000);
+    std::vector<int> weights(len * len),
+        below(len * len);
+    std::vector<bool> usedY(len, false);
+    Index index(len);
+    int passed = 0,
+        failed = 0,
+        largest = 0,
+        max_probes = 2,
+        i, j;
+
+    for (i = 0; i < len; ++i) {
+        for (j = 0; j < len; ++j) {
+            weights[index.index(i, j)] = i == 0 || j == 0 ? i + j : dist(gen);
+        }
+    }
+    Bottleneck bot(weights.data(), len);
+    bot.init();
+    for (i = 0; i < len; ++i) {
+        if (bot.matchX(i) < 0 || usedY[bot.matchX(i)]) break;
+        usedY[bot.matchX(i)] = true;
+        largest = std::max(largest, weights[index.index(i, bot.matchX(i))]);
+    }
+    check(i == len, "Matching not perfect!", passed, failed);
+    check(largest == bot.threshold(), "Largest matched weight differs from threshold!", passed, failed);
+    for (std::size_t k = 0; k < weights.size(); ++k) {
+        below[k] = weights[k] < bot.threshold() ? 1 : 0;
+    }
+    MaxMatch mm(below.data(), len, len);
+    mm.init();
+    check(mm.matches() < len, "Perfect matching below the threshold!", passed, failed);
+    // two searches per halving of the edges
+    for (std::size_t cells = weights.size(); cells > 1; cells /= 2) {
+        max_probes += 2;
+    }
+    check(bot.probes() <= max_probes, "Too many threshold probes!", passed, failed);
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << (failed > 0 ? BOLDRED : RESET) << failed << " tests failed" << RESET << std::endl << std::endl;
+}
+
+int brute_force(const int *weights, const int &len) {
+    std::vector<int> perm(len);
+    int best = -1,
+        largest,
+        i;
+    Index index(len);
+
+    for (i = 0; i < len; ++i) {
+        perm[i] = i;
+    }
+    do {
+        largest = weights[index.index(0, perm[0])];
+        for (i = 1; i < len; ++i) {
+            largest = std::max(largest, weights[index.index(i, perm[i])]);
+        }
+        if (best < 0 || largest < best) best = largest;
+    } while (std::next_permutation(perm.begin(), perm.end()));
+    return best;
+}
+
+void check(const bool &ok, const char *msg, int &passed, int &failed) {
+    if (ok) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << msg << RESET << std::endl;
+    }
+}
@@ -0,0 +1,237 @@
+/**
+ * costscaling_test.cpp
+ * Test suite for the cost scaling assignment solver.
+ * Results are checked against known answers, against
+ * Hungarian and against brute force for weights
+ * too large for Hungarian's int totals.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "costscaling.h"
+#include "hungarian.h"
+#include "index.h"
+
+#define RESET "\033[0m"
+#define BOLDRED "\033[1m\033[31m"
+
+void test_dense(const char *, const int *, const int &, const long long &);
+void test_random(const int &, const int &, const unsigned &);
+void test_sparse(const char *, const int *, const int &, const int &);
+void test_large_weights(const int &, const unsigned &);
+void test_total(CostScaling &, const long long &, int &, int &);
+void test_match_consistency(CostScaling &, int &, int &);
+long long brute_force(const int *, const int &);
+void report(const int &, const int &);
+
+int main() {
+    int weights1[] = {
+        1, 6, 0,
+        0, 8, 6,
+        4, 0, 1
+    };
+    test_dense("Test case 1", weights1, 3, 16);
+
+    int weights2[] = {
+        3, 2, 3,
+        1, 2, 0,
+        3, 2, 1
+    };
+    test_dense("Test case 2", weights2, 3, 8);
+
+    int weights3[] = {
+        8, 15, 54, 32,
+        50, 19, 9, 98,
+        50, 79, 80, 30,
+        76, 86, 85, 48
+    };
+    test_dense("Test case 3", weights3, 4, 307);
+
+    int weights4[] = {
+        35, 26, 56, 57, 17, 97, 27, 84, 7,
+        12, 83, 89, 3, 23, 65, 34, 19, 90,
+        16, 94, 80, 63, 26, 4, 15, 15, 18,
+        19, 36, 47, 41, 74, 16, 19, 47, 39,
+        15, 41, 40, 16, 84, 92, 54, 18, 74,
+        68, 14, 21, 46, 65, 57, 19, 37, 21,
+        34, 48, 59, 69, 95, 68, 19, 80, 97,
+        55, 77, 31, 13, 72, 39, 52, 94, 56,
+        4, 85, 25, 73, 61, 58, 80, 81, 84
+    };
+    test_dense("Test case 4", weights4, 9, 745);
+
+    int weights5[] = {
+        0, 7, 0, 0,
+        5, 0, 0, 0,
+        0, 9, 0, 0,
+        0, 0, 3, 0,
+        0, 0, 0, 0
+    };
+    test_sparse("Test case 5 (sparse)", weights5, 5, 4);
+    test_sparse("Test case 4 (sparse)", weights4, 9, 9);
+
+    test_random(30, 1000, 1);
+    test_random(50, 5, 2);
+    test_large_weights(7, 3);
+
+    return 0;
+}
+
+void test_dense(const char *msg, const int *weights, const int &len, const long long &expected) {
+    std::cout << msg << std::endl;
+    int passed = 0,
+        failed = 0;
+    CostScaling cs(weights, len);
+
+    cs.init();
+    test_total(cs, expected, passed, failed);
+    test_match_consistency(cs, passed, failed);
+    report(passed, failed);
+}
+
+/**
+ * sparse input built from the nonzero entries of a dense matrix
+ * has the same maximum weight as the dense matrix padded to square
+ */
+void test_sparse(const char *msg, const int *weights, const int &rows, const int &cols) {
+    std::cout << msg << std::endl;
+    int len = std::max(rows, cols),
+        passed = 0,
+        failed = 0,
+        i, j;
+    Index index(cols),
+        padded_index(len);
+    std::vector<int> x, y, w, padded(len * len, 0);
+
+    for (i = 0; i < rows; ++i) {
+        for (j = 0; j < cols; ++j) {
+            padded[padded_index.index(i, j)] = weights[index.index(i, j)];
+            if (weights[index.index(i, j)] != 0) {
+                x.push_back(i);
+                y.push_back(j);
+                w.push_back(weights[index.index(i, j)]);
+            }
+        }
+    }
+    Hungarian hung(padded.data(), len);
+    hung.init();
+    CostScaling cs(x.data(), y.data(), w.data(), w.size(), rows, cols);
+    cs.init();
+    test_total(cs, hung.get_match_total(), passed, failed);
+    test_match_consistency(cs, passed, failed);
+    std::cout << "Matches belong to graph" << std::endl;
+    for (i = 0; i < rows; ++i) {
+        if (cs.matchX(i) < 0 || weights[index.index(i, cs.matchX(i))] != 0) {
+            ++passed;
+        } else {
+            ++failed;
+            std::cerr << BOLDRED << "Match (" << i << ", " << cs.matchX(i) << ") is not an edge" 
+                << RESET << std::endl;
+        }
+    }
+    report(passed, failed);
+}
+
+void test_random(const int &len, const int &max_weight, const unsigned &seed) {
+    std::cout << "Random " << len << " x " << len << " weights in [0, " << max_weight 
+        << "] against Hungarian" << std::endl;
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, max_weight);
+    std::vector<int> weights(len * len);
+    int passed = 0,
+        failed = 0;
+
+    for (int &w : weights) {
+        w = dist(gen);
+    }
+    Hungarian hung(weights.data(), len);
+    hung.init();
+    CostScaling cs(weights.data(), len);
+    cs.init();
+    test_total(cs, hung.get_match_total(), passed, failed);
+    test_match_consistency(cs, passed, failed);
+    report(passed, failed);
+}
+
+void test_large_weights(const int &len, const unsigned &seed) {
+    std::cout << "Weights in [0, 10^9] against brute force" << std::endl;
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, 1000000000);
+    std::vector<int> weights(len * len);
+    int passed = 0,
+        failed = 0;
+
+    for (int &w : weights) {
+        w = dist(gen);
+    }
+    CostScaling cs(weights.data(), len);
+    cs.init();
+    test_total(cs, brute_force(weights.data(), len), passed, failed);
+    test_match_consistency(cs, passed, failed);
+    report(passed, failed);
+}
+
+void test_total(CostScaling &cs, const long long &expected, int &passed, int &failed) {
+    std::cout << "Test maximum weight" << std::endl;
+    long long actual = cs.get_match_total();
+
+    if (actual == expected) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << "Incorrect maximum weight for match!" << std::endl;
+        std::cerr << "expected: " << expected << ", actual: " << actual << RESET << std::endl;
+    }
+}
+
+void test_match_consistency(CostScaling &cs, int &passed, int &failed) {
+    std::cout << "Matches by X and by Y are consistent" << std::endl;
+    for (int i = 0; i < cs.sizeX(); ++i) {
+        if (cs.matchX(i) == -1 || cs.matchY(cs.matchX(i)) == i) {
+            ++passed;
+        } else {
+            ++failed;
+            std::cerr << BOLDRED << "matchX and matchY inconsistent for value " << i << RESET << std::endl;
+        }
+    }
+    for (int i = 0; i < cs.sizeY(); ++i) {
+        if (cs.matchY(i) == -1 || cs.matchX(cs.matchY(i)) == i) {
+            ++passed;
+        } else {
+            ++failed;
+            std::cerr << BOLDRED << "matchY and matchX inconsistent for value " << i << RESET << std::endl;
+        }
+    }
+}
+
+long long brute_force(const int *weights, const int &len) {
+    std::vector<int> perm(len);
+    long long best = 0, total;
+    Index index(len);
+
+    for (int i = 0; i < len; ++i) {
+        perm[i] = i;
+    }
+    do {
+        total = 0;
+        for (int i = 0; i < len; ++i) {
+            total += weights[index.index(i, perm[i])];
+        }
+        best = std::max(best, total);
+    } while (std::next_permutation(perm.begin(), perm.end()));
+    return best;
+}
+
+void report(const int &passed, const int &failed) {
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << (failed > 0 ? BOLDRED : RESET) << failed << " tests failed" << RESET << std::endl << std::endl;
+}
@@ -0,0 +1,187 @@
+/**
+ * externalmatch_test.cpp
+ * Test suite for maximum matching over adjacency on disk.
+ * Graphs are written to a temporary file, and the matching
+ * must be as large as the one MaxMatch finds in memory.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "externalmatch.h"
+#include "index.h"
+#include "maxmatch.h"
+
+#define RESET "\033[0m"
+#define BOLDRED "\033[1m\033[31m"
+
+void test(const char *, const int *, const int &, const int &);
+void test_bad_file();
+bool rejected(const char *, const long &, const std::uint64_t &, const int &);
+void check(const bool &, const char *, int &, int &);
+
+int main() {
+    /**
+     * CLRS, p. 733
+     */
+    int graph1[] = {
+        1, 0, 0, 0,
+        1, 0, 1, 0,
+        0, 1, 1, 1,
+        0, 0, 1, 0,
+        0, 0, 1, 0
+    };
+    test("Test case 1", graph1, 5, 4);
+
+    /**
+     * Sedgewick, Algorithms in C, vol. 2, p. 420
+     */
+    int graph2[] = {
+        1, 1, 1, 0, 0, 0,
+        1, 1, 0, 0, 0, 1,
+        0, 0, 1, 1, 1, 0,
+        1, 1, 0, 0, 0, 0,
+        0, 0, 0, 1, 1, 1,
+        0, 0, 1, 0, 1, 1
+    };
+    test("Test case 2", graph2, 6, 6);
+
+    int graph3[] = {
+        0, 0, 0,
+        0, 0, 0
+    };
+    test("No edges", graph3, 2, 3);
+
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<int> dist(0, 399);
+    std::vector<int> graph4(300 * 400, 0);
+    for (int i = 0; i < 300; ++i) {
+        for (int k = 0; k < 2; ++k) {
+            graph4[i * 400 + dist(gen)] = 1;
+        }
+    }
+    test("Random sparse 300 x 400", graph4.data(), 300, 400);
+
+    test_bad_file();
+
+    return 0;
+}
+
+void test(const char *msg, const int *graph, const int &rows, const int &cols) {
+    std::cout << msg << std::endl;
+    int passed = 0,
+        failed = 0,
+        i, j;
+    char path[] = "/tmp/externalmatch_testXXXXXX";
+    Index index(cols);
+    std::vector<int> x, y;
+    MaxMatch mm(graph, rows, cols);
+    bool consistent = true;
+
+    close(mkstemp(path));
+    for (i = 0; i < rows; ++i) {
+        for (j = 0; j < cols; ++j) {
+            if (graph[index.index(i, j)] == 0) continue;
+            x.push_back(i);
+            y.push_back(j);
+        }
+    }
+    ExternalMatch::write(path, x.data(), y.data(), x.size(), rows, cols);
+    ExternalMatch em(path);
+    std::remove(path);
+
+    check(em.sizeX() == rows && em.sizeY() == cols && em.edges() == x.size(),
+            "Incorrect sizes read from file!", passed, failed);
+    mm.init();
+    em.init();
+    check(em.matches() == mm.matches(), "Incorrect number of matches!", passed, failed);
+    for (i = 0; i < rows; ++i) {
+        if (em.match_X(i) < 0) continue;
+        consistent = consistent && em.match_Y(em.match_X(i)) == i &&
+            graph[index.index(i, em.match_X(i))] != 0;
+    }
+    check(consistent, "Matches not edges of the graph!", passed, failed);
+    // a second run starts over
+    em.init();
+    check(em.matches() == mm.matches(), "Incorrect number of matches on second run!", passed, failed);
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << (failed > 0 ? BOLDRED : RESET) << failed << " tests failed" << RESET << std::endl << std::endl;
+}
+
+void test_bad_file() {
+    std::cout << "Bad file" << std::endl;
+    int passed = 0,
+        failed = 0;
+    char path[] = "/tmp/externalmatch_testXXXXXX";
+    bool thrown = false;
+    int fd = mkstemp(path);
+
+    check(::write(fd, "not a graph", 11) == 11, "Cannot write test file!", passed, failed);
+    close(fd);
+    try {
+        ExternalMatch em(path);
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+    check(thrown, "Bad file accepted!", passed, failed);
+    std::remove(path);
+    // 2 x 2 graph: header at 0, offsets at 32, adjacency at 56
+    check(rejected(path, 8, 1ULL << 62, 8), "Huge row count accepted!", passed, failed);
+    check(rejected(path, 16, 1ULL << 40, 8), "Column count above INT_MAX accepted!", passed, failed);
+    check(rejected(path, 40, 5, 8), "Decreasing offsets accepted!", passed, failed);
+    check(rejected(path, 48, 3, 8), "Offsets past the edges accepted!", passed, failed);
+    check(rejected(path, 56, 2, 4), "Y vertex out of range accepted!", passed, failed);
+    check(rejected(path, 60, static_cast<std::uint32_t>(-1), 4), "Negative Y vertex accepted!", 
+            passed, failed);
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << (failed > 0 ? BOLDRED : RESET) << failed << " tests failed" << RESET << std::endl << std::endl;
+}
+
+/**
+ * write a valid 2 x 2 graph, overwrite bytes bytes at offset
+ * with value and check that the graph is refused
+ */
+bool rejected(const char *path, const long &offset, const std::uint64_t &value, const int &bytes) {
+    int x[] = {0, 1},
+        y[] = {1, 0};
+    bool thrown = false;
+
+    ExternalMatch::write(path, x, y, 2, 2, 2);
+    int fd = open(path, O_WRONLY);
+    if (fd < 0 || pwrite(fd, &value, bytes, offset) != bytes) {
+        if (fd >= 0) close(fd);
+        std::remove(path);
+        return false;
+    }
+    close(fd);
+    try {
+        ExternalMatch em(path);
+        em.init();
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+    std::remove(path);
+    return thrown;
+}
+
+void check(const bool &ok, const char *msg, int &passed, int &failed) {
+    if (ok) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << msg << RESET << std::endl;
+    }
+}
@@ -11,7 +11,10 @@
  * Since 2014-05-23
  */
 
+#include <cstddef>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 #include "hungarian.h"
 #include "index.h"
@@ -25,6 +28,10 @@ void test_length(const Hungarian &, const int &, int &, int &);
 void test_weights(const int *, const Hungarian &, int &, int &);
 void test_match_count(const Hungarian &, const int &, int &, int &);
 void test_init(const int *, Hungarian &, const int &, const int &);
+void test_deadline(const int *, const int &, const int &, const int &);
+void test_reassign(const int *, const int &, const int &, const int &);
+void test_move(const int *, const int &, const int &);
+void test_shrink();
 
 int main() {
     int weights1[] = {
@@ -74,6 +81,7 @@ int main() {
     first_match_count = 6;
     final_answer = 745;
     test("Test case 4", weights4, len, first_match_count, final_answer);
+    test_shrink();
 
     return 0;
 }
@@ -84,6 +92,9 @@ void test(const char *msg, const int *weights, const int &len, const int &first_
     Hungarian hung(weights, len);
     test_ctor(weights, hung, len, first_match_count);
     test_init(weights, hung, len, final_answer);
+    test_deadline(weights, len, first_match_count, final_answer);
+    test_reassign(weights, len, first_match_count, final_answer);
+    test_move(weights, len, final_answer);
 }
 
 void test_ctor(const int *weights, const Hungarian &hung, const int &len, const int &first_match_count) {
@@ -161,6 +172,181 @@ void test_init(const int *weights, Hungarian &hung, const int &len, const int &e
         std::cerr << BOLDRED << "Incorrect maximum weight for match!" << std::endl;
         std::cerr << "expected: " << expected << ", actual: " << actual << RESET << std::endl;
     }
+    if (hung.get_dual_bound() == expected) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << "Dual bound not tight at optimum!" << std::endl;
+        std::cerr << "expected: " << expected << ", actual: " << hung.get_dual_bound() << RESET << std::endl;
+    }
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << (failed > 0 ? BOLDRED : RESET) << failed << " tests failed" << RESET << std::endl << std::endl;
+}
+
+void test_deadline(const int *weights, const int &len, const int &first_match_count, const int &expected) {
+    std::cout << "Test init() with expired deadline and cancellation" << std::endl;
+    int passed = 0,
+        failed = 0;
+    Hungarian expired(weights, len),
+        cancelled(weights, len);
+    std::atomic<bool> cancel(true);
+    bool complete = first_match_count == len;
+
+    if (expired.init(std::chrono::steady_clock::now()) == complete &&
+            cancelled.init(std::chrono::steady_clock::time_point::max(), &cancel) == complete) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << "Solve did not stop at deadline or cancellation!" << RESET << std::endl;
+    }
+    test_match_count(expired, first_match_count, passed, failed);
+    if (expired.get_match_total() <= expected && expected <= expired.get_dual_bound()) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << "Partial result does not bracket the optimum!" << std::endl;
+        std::cerr << "expected: " << expired.get_match_total() << " <= " << expected << " <= " 
+            << expired.get_dual_bound() << RESET << std::endl;
+    }
+    cancel = false;
+    if (cancelled.init(std::chrono::steady_clock::time_point::max(), &cancel) && 
+            cancelled.get_match_total() == expected) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << "Resumed solve is not optimal!" << RESET << std::endl;
+    }
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << (failed > 0 ? BOLDRED : RESET) << failed << " tests failed" << RESET << std::endl << std::endl;
+}
+
+void test_reassign(const int *weights, const int &len, const int &first_match_count, const int &expected) {
+    std::cout << "Test reassign() to a larger and back to a smaller problem" << std::endl;
+    int passed = 0,
+        failed = 0,
+        single = 7;
+    Hungarian hung(&single, 1);
+
+    hung.init();
+    hung.reassign(weights, len);
+    test_length(hung, len, passed, failed);
+    test_weights(weights, hung, passed, failed);
+    test_match_count(hung, first_match_count, passed, failed);
+    hung.init();
+    if (hung.get_match_total() == expected) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << "Incorrect maximum weight after reassign()!" << std::endl;
+        std::cerr << "expected: " << expected << ", actual: " << hung.get_match_total() << RESET << std::endl;
+    }
+    hung.reassign(&single, 1);
+    hung.init();
+    if (hung.get_match_total() == single && 
+            hung.capacity() == static_cast<std::size_t>(len) * len) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << "Smaller problem not solved in place!" << std::endl;
+        std::cerr << "total: " << hung.get_match_total() << ", capacity: " << hung.capacity() << RESET << std::endl;
+    }
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << (failed > 0 ? BOLDRED : RESET) << failed << " tests failed" << RESET << std::endl << std::endl;
+}
+
+void test_move(const int *weights, const int &len, const int &expected) {
+    std::cout << "Test moving solvers" << std::endl;
+    int passed = 0,
+        failed = 0;
+    Hungarian hung(weights, len);
+    std::vector<Hungarian> pool;
+
+    pool.push_back(std::move(hung));
+    // growing the vector moves the solvers again
+    for (int i = 0; i < 8; ++i) {
+        pool.emplace_back(weights, len);
+    }
+    pool[0].init();
+    pool[1] = std::move(pool[0]);
+    if (pool[1].get_match_total() == expected && hung.length() == 0) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << "Solver state lost in move!" << std::endl;
+        std::cerr << "expected: " << expected << ", actual: " << pool[1].get_match_total() << RESET << std::endl;
+    }
+    // assignment empties the source as construction does
+    if (pool[0].length() == 0 && pool[0].capacity() == 0) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << "Solver not empty after move assignment!" << std::endl;
+        std::cerr << "length: " << pool[0].length() << ", capacity: " << pool[0].capacity() << RESET << std::endl;
+    }
+    // a moved-from solver can be reused
+    hung.reassign(weights, len);
+    hung.init();
+    if (hung.get_match_total() == expected) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << "Moved-from solver not reusable!" << RESET << std::endl;
+    }
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << (failed > 0 ? BOLDRED : RESET) << failed << " tests failed" << RESET << std::endl << std::endl;
+}
+
+/**
+ * grow above NumaAlloc::MIN_PLACED_BYTES, so the matrices are
+ * mapped, then shrink without reallocating. Destroying the solver
+ * must release the storage allocated, not the current size.
+ */
+void test_shrink() {
+    std::cout << "Test shrinking mapped storage" << std::endl;
+    int passed = 0,
+        failed = 0,
+        len = 1100,
+        shrunk = len - 50,
+        i;
+    int small[] = {
+        3, 1,
+        1, 2
+    };
+    std::vector<int> weights(len * len, 0),
+        weights_shrunk(shrunk * shrunk, 0);
+
+    // the diagonal is optimal and already tight, so init() is cheap
+    for (i = 0; i < len; ++i) {
+        weights[i * len + i] = 1;
+    }
+    for (i = 0; i < shrunk; ++i) {
+        weights_shrunk[i * shrunk + i] = 1;
+    }
+    {
+        Hungarian hung(weights.data(), len);
+        hung.reassign(weights_shrunk.data(), shrunk);
+        hung.init();
+        if (hung.get_match_total() == shrunk) {
+            ++passed;
+        } else {
+            ++failed;
+            std::cerr << BOLDRED << "Incorrect total after shrinking!" << std::endl;
+            std::cerr << "expected: " << shrunk << ", actual: " << hung.get_match_total() << RESET << std::endl;
+        }
+    }
+    {
+        Hungarian hung(weights.data(), len);
+        hung.reassign(small, 2);
+        hung.init();
+        if (hung.get_match_total() == 5 && 
+                hung.capacity() == static_cast<std::size_t>(len) * len) {
+            ++passed;
+        } else {
+            ++failed;
+            std::cerr << BOLDRED << "Small problem not solved in mapped storage!" << std::endl;
+            std::cerr << "total: " << hung.get_match_total() << ", capacity: " << hung.capacity() << RESET << std::endl;
+        }
+    }
     std::cout << passed << " tests passed" << std::endl;
     std::cout << (failed > 0 ? BOLDRED : RESET) << failed << " tests failed" << RESET << std::endl << std::endl;
 }
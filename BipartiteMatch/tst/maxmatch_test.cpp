@@ -9,7 +9,11 @@
  * Since 2014-05-29
  */
 
+#include <atomic>
+#include <chrono>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 #include "maxmatch.h"
 #include "index.h"
@@ -23,6 +27,13 @@ void test_match_count(MaxMatch &, const int &, int &, int &);
 void test_match_consistency(MaxMatch &, int &, int &);
 void test_set_graph(MaxMatch &);
 void test_delete_edge(MaxMatch &, const int &, const int &, const int &);
+void test_cover(MaxMatch &, int &, int &);
+void test_decomposition(MaxMatch &, int &, int &);
+void test_reassign(MaxMatch &);
+void test_move(const int *, const int &, const int &, const int &);
+void test_shrink();
+void test_edge_ctor(const int *, const int &, const int &, const int &);
+void test_deadline();
 
 int main() {
     /**
@@ -92,7 +103,8 @@ int main() {
     addj = 4;
     expected_after = 4;
     test("Test case 3", graph3, rows, cols, expected_matches, addi, addj, expected_after);
-    
+    test_shrink();
+    test_deadline();
 
     return 0;
 }
@@ -106,6 +118,9 @@ void test(const char *msg, const int *graph, const int &rows, const int &cols, c
     test_matches(mm, graph, rows, cols, expected_matches);
     test_add_edge(mm, addi, addj, expected_after);
     test_set_graph(mm);
+    test_reassign(mm);
+    test_move(graph, rows, cols, expected_matches);
+    test_edge_ctor(graph, rows, cols, expected_matches);
 }
 
 void test_constructor(MaxMatch &mm, const int *graph, const int &rows, const int &cols) {
@@ -192,6 +207,8 @@ void test_matches(MaxMatch &mm, const int *graph, const int &rows, const int &co
         }
     }
     test_match_consistency(mm, tests_passed, tests_failed);
+    test_cover(mm, tests_passed, tests_failed);
+    test_decomposition(mm, tests_passed, tests_failed);
     std::cout << tests_passed << " tests passed" << std::endl;
     std::cout << tests_failed << " tests failed" << std::endl << std::endl;
 }
@@ -292,3 +309,258 @@ void test_delete_edge(MaxMatch &mm, const int &from, const int &to, const int &e
     std::cout << passed << " tests passed" << std::endl;
     std::cout << failed << " tests failed" << std::endl << std::endl;
 }
+
+void test_cover(MaxMatch &mm, int &passed, int &failed) {
+    std::cout << "Vertex cover is minimum and covers all edges" << std::endl;
+    int cover_size = 0,
+        i,
+        j;
+
+    for (i = 0; i < mm.sizeX(); ++i) {
+        if (mm.cover_X(i)) ++cover_size;
+    }
+    for (j = 0; j < mm.sizeY(); ++j) {
+        if (mm.cover_Y(j)) ++cover_size;
+    }
+    if (cover_size == mm.matches()) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cout << "Incorrect vertex cover size!" << std::endl;
+        std::cout << "expected: " << mm.matches() << ", actual: " << cover_size << std::endl;
+    }
+    for (i = 0; i < mm.sizeX(); ++i) {
+        for (j = 0; j < mm.sizeY(); ++j) {
+            if (!mm.has_graph_edge(i, j) || mm.cover_X(i) || mm.cover_Y(j)) {
+                ++passed;
+            } else {
+                ++failed;
+                std::cout << "Edge (" << i << ", " << j << ") not covered" << std::endl;
+            }
+        }
+    }
+}
+
+void test_decomposition(MaxMatch &mm, int &passed, int &failed) {
+    std::cout << "Dulmage-Mendelsohn classes are consistent" << std::endl;
+    int i, j;
+
+    mm.decompose();
+    for (i = 0; i < mm.sizeX(); ++i) {
+        // free vertices are even, odd and perfect vertices are always matched
+        if (mm.match_X(i) >= 0 || mm.dm_X(i) == MaxMatch::DM_EVEN) {
+            ++passed;
+        } else {
+            ++failed;
+            std::cout << "Incorrect class for X vertex " << i << std::endl;
+        }
+    }
+    for (j = 0; j < mm.sizeY(); ++j) {
+        if (mm.match_Y(j) >= 0 || mm.dm_Y(j) == MaxMatch::DM_EVEN) {
+            ++passed;
+        } else {
+            ++failed;
+            std::cout << "Incorrect class for Y vertex " << j << std::endl;
+        }
+    }
+    for (i = 0; i < mm.sizeX(); ++i) {
+        for (j = 0; j < mm.sizeY(); ++j) {
+            if (!mm.has_graph_edge(i, j)) continue;
+            // even vertices only neighbor odd vertices, perfect only perfect or odd
+            if ((mm.dm_X(i) == MaxMatch::DM_EVEN && mm.dm_Y(j) != MaxMatch::DM_ODD) ||
+                    (mm.dm_Y(j) == MaxMatch::DM_EVEN && mm.dm_X(i) != MaxMatch::DM_ODD) ||
+                    (mm.dm_X(i) == MaxMatch::DM_PERFECT && mm.dm_Y(j) == MaxMatch::DM_EVEN) ||
+                    (mm.dm_Y(j) == MaxMatch::DM_PERFECT && mm.dm_X(i) == MaxMatch::DM_EVEN)) {
+                ++failed;
+                std::cout << "Edge (" << i << ", " << j << ") joins incompatible classes" << std::endl;
+            } else {
+                ++passed;
+            }
+        }
+    }
+}
+
+void test_reassign(MaxMatch &mm) {
+    std::cout << "Test reassigning graph of other size" << std::endl;
+    int passed = 0,
+        failed = 0,
+        rows = mm.sizeX(),
+        len, i;
+    std::size_t capacity = mm.capacity();
+
+    for (len = rows - 1; len <= rows + 1; len += 2) {
+        std::vector<int> graph(len * len, 0);
+        for (i = 0; i < len; ++i) {
+            graph[i * len + i] = 1;
+        }
+        mm.reassign(graph.data(), len, len);
+        mm.init();
+        test_match_count(mm, len, passed, failed);
+        test_match_consistency(mm, passed, failed);
+        if (static_cast<std::size_t>(len * len) <= capacity) {
+            if (mm.capacity() == capacity) {
+                ++passed;
+            } else {
+                ++failed;
+                std::cout << "Storage reallocated for smaller graph!" << std::endl;
+            }
+        } else if (mm.capacity() >= static_cast<std::size_t>(len * len)) {
+            ++passed;
+        } else {
+            ++failed;
+            std::cout << "Storage not grown for larger graph!" << std::endl;
+        }
+    }
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << failed << " tests failed" << std::endl << std::endl;
+}
+
+void test_move(const int *graph, const int &rows, const int &cols, const int &expected) {
+    std::cout << "Test moving solvers" << std::endl;
+    int passed = 0,
+        failed = 0;
+    MaxMatch mm(graph, rows, cols);
+    std::vector<MaxMatch> pool;
+
+    mm.init();
+    pool.push_back(std::move(mm));
+    // growing the vector moves the solvers again
+    for (int i = 0; i < 8; ++i) {
+        pool.emplace_back(graph, rows, cols);
+    }
+    test_match_count(pool[0], expected, passed, failed);
+    test_match_consistency(pool[0], passed, failed);
+    if (mm.sizeX() == 0 && mm.sizeY() == 0 && mm.capacity() == 0) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cout << "Moved-from solver not empty!" << std::endl;
+    }
+    pool[1] = std::move(pool[0]);
+    test_match_count(pool[1], expected, passed, failed);
+    // assignment empties the source as construction does
+    if (pool[0].sizeX() == 0 && pool[0].sizeY() == 0 && pool[0].capacity() == 0) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cout << "Solver not empty after move assignment!" << std::endl;
+    }
+    // a moved-from solver can be reused
+    mm.reassign(graph, rows, cols);
+    mm.init();
+    test_match_count(mm, expected, passed, failed);
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << failed << " tests failed" << std::endl << std::endl;
+}
+
+/**
+ * grow above NumaAlloc::MIN_PLACED_BYTES, so the graph is mapped,
+ * then shrink without reallocating. Destroying the solver must
+ * release the storage allocated, not the current size.
+ */
+void test_shrink() {
+    std::cout << "Test shrinking mapped storage" << std::endl;
+    int passed = 0,
+        failed = 0,
+        len = 1100,
+        shrunk = len - 50,
+        i;
+    int small[] = {
+        1, 0,
+        0, 1
+    };
+    std::vector<int> graph(len * len, 0),
+        graph_shrunk(shrunk * shrunk, 0);
+
+    for (i = 0; i < len; ++i) {
+        graph[i * len + i] = 1;
+    }
+    for (i = 0; i < shrunk; ++i) {
+        graph_shrunk[i * shrunk + i] = 1;
+    }
+    {
+        MaxMatch mm(graph.data(), len, len);
+        mm.init();
+        test_match_count(mm, len, passed, failed);
+        // still mapped at the smaller size
+        mm.reassign(graph_shrunk.data(), shrunk, shrunk);
+        mm.init();
+        test_match_count(mm, shrunk, passed, failed);
+    }
+    {
+        MaxMatch mm(graph.data(), len, len);
+        mm.reassign(small, 2, 2);
+        mm.init();
+        test_match_count(mm, 2, passed, failed);
+        if (mm.capacity() == static_cast<std::size_t>(len) * len) {
+            ++passed;
+        } else {
+            ++failed;
+            std::cout << "Storage reallocated for smaller graph!" << std::endl;
+        }
+    }
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << failed << " tests failed" << std::endl << std::endl;
+}
+
+void test_edge_ctor(const int *graph, const int &rows, const int &cols, const int &expected) {
+    std::cout << "Test building graph edge by edge" << std::endl;
+    int passed = 0,
+        failed = 0,
+        i, j;
+    Index index(cols);
+    MaxMatch mm(rows, cols);
+
+    mm.init();
+    test_match_count(mm, 0, passed, failed);
+    for (i = 0; i < rows; ++i) {
+        for (j = 0; j < cols; ++j) {
+            if (graph[index.index(i, j)] != 0) mm.add_graph_edge(i, j);
+        }
+    }
+    mm.init();
+    test_match_count(mm, expected, passed, failed);
+    test_match_consistency(mm, passed, failed);
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << failed << " tests failed" << std::endl << std::endl;
+}
+
+/**
+ * the first pass matches x0 with y0 and leaves x1 free, so
+ * a maximum matching needs a second pass
+ */
+void test_deadline() {
+    std::cout << "Test init() with expired deadline and cancellation" << std::endl;
+    int passed = 0,
+        failed = 0;
+    int graph[] = {
+        1, 1,
+        1, 0
+    };
+    MaxMatch expired(graph, 2, 2),
+        cancelled(graph, 2, 2);
+    std::atomic<bool> cancel(true);
+
+    if (!expired.init(std::chrono::steady_clock::now()) && 
+            !cancelled.init(std::chrono::steady_clock::time_point::max(), &cancel)) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cout << "Search did not stop at deadline or cancellation!" << std::endl;
+    }
+    test_match_count(expired, 1, passed, failed);
+    test_match_consistency(expired, passed, failed);
+    // a later call extends the partial matching
+    expired.init();
+    test_match_count(expired, 2, passed, failed);
+    cancel = false;
+    if (cancelled.init(std::chrono::steady_clock::time_point::max(), &cancel)) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cout << "Resumed search did not finish!" << std::endl;
+    }
+    test_match_count(cancelled, 2, passed, failed);
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << failed << " tests failed" << std::endl << std::endl;
+}
@@ -0,0 +1,84 @@
+/**
+ * numaalloc_test.cpp
+ * Test suite for NUMA-aware matrix allocation.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <iostream>
+#include <vector>
+
+#include "numaalloc.h"
+
+#define RESET "\033[0m"
+#define BOLDRED "\033[1m\033[31m"
+
+void test_topology(int &, int &);
+void test_alloc(const std::size_t &, const NumaAlloc::Placement &, int &, int &);
+void check(const bool &, const char *, int &, int &);
+
+int main() {
+    int passed = 0,
+        failed = 0;
+
+    std::cout << "Test NUMA allocation" << std::endl;
+    test_topology(passed, failed);
+    // below and above MIN_PLACED_BYTES
+    test_alloc(5, NumaAlloc::PLACEMENT_FIRST_TOUCH, passed, failed);
+    test_alloc(1200, NumaAlloc::PLACEMENT_FIRST_TOUCH, passed, failed);
+    test_alloc(1200, NumaAlloc::PLACEMENT_INTERLEAVE, passed, failed);
+    test_alloc(1200, NumaAlloc::PLACEMENT_LOCAL, passed, failed);
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << (failed > 0 ? BOLDRED : RESET) << failed << " tests failed" << RESET << std::endl << std::endl;
+    return 0;
+}
+
+void test_topology(int &passed, int &failed) {
+    std::cout << "Test topology" << std::endl;
+    const NumaAlloc &numa = NumaAlloc::system();
+    bool cpus_ok = numa.nodes() >= 1;
+
+    for (int node = 0; node < numa.nodes(); ++node) {
+        cpus_ok = cpus_ok && !numa.cpus(node).empty();
+    }
+    check(cpus_ok, "Node without cpus!", passed, failed);
+    check(numa.first_row(0, 100) == 0 && numa.first_row(numa.nodes(), 100) == 100, 
+            "Row blocks don't cover the matrix!", passed, failed);
+    check(NumaAlloc::pin(numa.cpu(0, 4)), "Can't pin to first worker's cpu!", passed, failed);
+}
+
+void test_alloc(const std::size_t &len, const NumaAlloc::Placement &placement, int &passed, int &failed) {
+    std::cout << "Test alloc() of " << len << " x " << len << std::endl;
+    std::vector<int> src(len * len);
+    std::size_t k;
+
+    for (k = 0; k < src.size(); ++k) {
+        src[k] = k % 1000;
+    }
+    int *copy = NumaAlloc::system().alloc(len, len, src.data(), placement),
+        *zero = NumaAlloc::system().alloc(len, len, nullptr, placement);
+    bool copy_ok = true,
+        zero_ok = true;
+
+    for (k = 0; k < src.size(); ++k) {
+        copy_ok = copy_ok && copy[k] == src[k];
+        zero_ok = zero_ok && zero[k] == 0;
+    }
+    check(copy_ok, "Copied matrix differs from source!", passed, failed);
+    check(zero_ok, "Matrix not zeroed!", passed, failed);
+    NumaAlloc::release(copy, len, len);
+    NumaAlloc::release(zero, len, len);
+}
+
+void check(const bool &ok, const char *msg, int &passed, int &failed) {
+    if (ok) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << msg << RESET << std::endl;
+    }
+}
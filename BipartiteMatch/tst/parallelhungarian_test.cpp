@@ -0,0 +1,119 @@
+/**
+ * parallelhungarian_test.cpp
+ * Test suite for the multithreaded Hungarian algorithm,
+ * checked against known answers and against Hungarian
+ * for several team sizes.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "hungarian.h"
+#include "parallelhungarian.h"
+
+#define RESET "\033[0m"
+#define BOLDRED "\033[1m\033[31m"
+
+void test(const char *, const int *, const int &, const long long &);
+void test_random(const int &, const int &, const unsigned &);
+void test_threads(const int *, const int &, const int &, const long long &, int &, int &);
+
+int main() {
+    int weights1[] = {
+        1, 6, 0,
+        0, 8, 6,
+        4, 0, 1
+    };
+    test("Test case 1", weights1, 3, 16);
+
+    int weights3[] = {
+        8, 15, 54, 32,
+        50, 19, 9, 98,
+        50, 79, 80, 30,
+        76, 86, 85, 48
+    };
+    test("Test case 3", weights3, 4, 307);
+
+    int weights4[] = {
+        35, 26, 56, 57, 17, 97, 27, 84, 7,
+        12, 83, 89, 3, 23, 65, 34, 19, 90,
+        16, 94, 80, 63, 26, 4, 15, 15, 18,
+        19, 36, 47, 41, 74, 16, 19, 47, 39,
+        15, 41, 40, 16, 84, 92, 54, 18, 74,
+        68, 14, 21, 46, 65, 57, 19, 37, 21,
+        34, 48, 59, 69, 95, 68, 19, 80, 97,
+        55, 77, 31, 13, 72, 39, 52, 94, 56,
+        4, 85, 25, 73, 61, 58, 80, 81, 84
+    };
+    test("Test case 4", weights4, 9, 745);
+
+    test_random(60, 1000, 1);
+    test_random(45, 3, 2);
+
+    return 0;
+}
+
+void test(const char *msg, const int *weights, const int &len, const long long &expected) {
+    std::cout << msg << std::endl;
+    int passed = 0,
+        failed = 0;
+
+    for (int threads = 1; threads <= 8; threads *= 2) {
+        test_threads(weights, len, threads, expected, passed, failed);
+    }
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << (failed > 0 ? BOLDRED : RESET) << failed << " tests failed" << RESET << std::endl << std::endl;
+}
+
+void test_random(const int &len, const int &max_weight, const unsigned &seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, max_weight);
+    std::vector<int> weights(len * len);
+
+    for (int &w : weights) {
+        w = dist(gen);
+    }
+    Hungarian hung(weights.data(), len);
+    hung.init();
+    test("Random weights against Hungarian", weights.data(), len, hung.get_match_total());
+}
+
+void test_threads(const int *weights, const int &len, const int &threads, const long long &expected, 
+        int &passed, int &failed) {
+    std::cout << "Test " << threads << " threads" << std::endl;
+    ParallelHungarian hung(weights, len, threads);
+    long long total = 0;
+    std::vector<bool> usedY(len, false);
+    bool perfect = true;
+
+    hung.init();
+    for (int i = 0; i < len; ++i) {
+        int y = hung.matchX(i);
+        if (y < 0 || usedY[y] || hung.matchY(y) != i) {
+            perfect = false;
+            continue;
+        }
+        usedY[y] = true;
+        total += weights[i * len + y];
+    }
+    if (perfect) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << "Matching not perfect or inconsistent!" << RESET << std::endl;
+    }
+    if (total == expected && hung.get_match_total() == expected) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << "Incorrect maximum weight for match!" << std::endl;
+        std::cerr << "expected: " << expected << ", actual: " << hung.get_match_total() << RESET << std::endl;
+    }
+}
@@ -0,0 +1,161 @@
+/**
+ * reduction_test.cpp
+ * Test suite for the Hungarian pre-pass: results must match
+ * Hungarian on the zero-padded problem, in both orientations.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "hungarian.h"
+#include "index.h"
+#include "reduction.h"
+
+#define RESET "\033[0m"
+#define BOLDRED "\033[1m\033[31m"
+
+void test(const char *, const int *, const int &, const int &);
+void test_forced(const int &);
+void test_random(const int &, const int &, const int &, const unsigned &);
+int padded_total(const int *, const int &, const int &);
+void test_matches(const Reduction &, const int *, const int &, const int &, int &, int &);
+void check(const bool &, const char *, int &, int &);
+
+int main() {
+    int weights3[] = {
+        8, 15, 54, 32,
+        50, 19, 9, 98,
+        50, 79, 80, 30,
+        76, 86, 85, 48
+    };
+    test("Test case 3", weights3, 4, 4);
+
+    int weights4[] = {
+        35, 26, 56, 57, 17, 97, 27, 84, 7,
+        12, 83, 89, 3, 23, 65, 34, 19, 90,
+        16, 94, 80, 63, 26, 4, 15, 15, 18,
+        19, 36, 47, 41, 74, 16, 19, 47, 39,
+        15, 41, 40, 16, 84, 92, 54, 18, 74,
+        68, 14, 21, 46, 65, 57, 19, 37, 21,
+        34, 48, 59, 69, 95, 68, 19, 80, 97,
+        55, 77, 31, 13, 72, 39, 52, 94, 56,
+        4, 85, 25, 73, 61, 58, 80, 81, 84
+    };
+    test("Test case 4", weights4, 9, 9);
+
+    int weights5[] = {
+        5, 0, 7,
+        1, 9, 2,
+        8, 3, 4,
+        6, 6, 6,
+        2, 8, 1
+    };
+    test("Test case 5 (5 x 3)", weights5, 5, 3);
+    test("Test case 5 (3 x 5)", weights5, 3, 5);
+
+    test_forced(20);
+    test_random(40, 40, 1000, 1);
+    test_random(25, 40, 1000, 2);
+    test_random(40, 25, 10, 3);
+
+    return 0;
+}
+
+void test(const char *msg, const int *weights, const int &rows, const int &cols) {
+    std::cout << msg << std::endl;
+    int passed = 0,
+        failed = 0;
+    Reduction red(weights, rows, cols);
+
+    red.init();
+    check(red.get_match_total() == padded_total(weights, rows, cols), 
+            "Incorrect maximum weight for match!", passed, failed);
+    check(red.reduced_length() + red.forced() == red.length(), 
+            "Reduced and forced vertices don't add up!", passed, failed);
+    test_matches(red, weights, rows, cols, passed, failed);
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << (failed > 0 ? BOLDRED : RESET) << failed << " tests failed" << RESET << std::endl << std::endl;
+}
+
+/**
+ * heavy diagonal: pruning leaves only the diagonal, all forced
+ */
+void test_forced(const int &len) {
+    std::cout << "Test forced assignments" << std::endl;
+    std::vector<int> weights(len * len, 1);
+    int passed = 0,
+        failed = 0;
+    Index index(len);
+
+    for (int i = 0; i < len; ++i) {
+        weights[index.index(i, i)] = 100;
+    }
+    Reduction red(weights.data(), len, len);
+    red.init();
+    check(red.get_match_total() == 100 * len, "Incorrect maximum weight for match!", passed, failed);
+    check(red.forced() == len && red.reduced_length() == 0, "Diagonal not forced!", passed, failed);
+    check(red.pruned() == len * len - len, "Off-diagonal edges not pruned!", passed, failed);
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << (failed > 0 ? BOLDRED : RESET) << failed << " tests failed" << RESET << std::endl << std::endl;
+}
+
+void test_random(const int &rows, const int &cols, const int &max_weight, const unsigned &seed) {
+    std::cout << "Random " << rows << " x " << cols << " weights in [0, " << max_weight << "]" << std::endl;
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, max_weight);
+    std::vector<int> weights(rows * cols);
+
+    for (int &w : weights) {
+        w = dist(gen);
+    }
+    test("", weights.data(), rows, cols);
+}
+
+int padded_total(const int *weights, const int &rows, const int &cols) {
+    int len = std::max(rows, cols);
+    std::vector<int> padded(len * len, 0);
+    Index input(cols),
+        index(len);
+
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) {
+            padded[index.index(i, j)] = weights[input.index(i, j)];
+        }
+    }
+    Hungarian hung(padded.data(), len);
+    hung.init();
+    return hung.get_match_total();
+}
+
+void test_matches(const Reduction &red, const int *weights, const int &rows, const int &cols, 
+        int &passed, int &failed) {
+    int total = 0,
+        matched = 0;
+    Index index(cols);
+
+    for (int i = 0; i < rows; ++i) {
+        if (red.matchX(i) < 0) continue;
+        ++matched;
+        total += weights[index.index(i, red.matchX(i))];
+        check(red.matchY(red.matchX(i)) == i, "matchX and matchY inconsistent!", passed, failed);
+    }
+    check(matched == std::min(rows, cols), "Smaller side not fully matched!", passed, failed);
+    check(total == red.get_match_total(), "Matches don't add up to the total!", passed, failed);
+}
+
+void check(const bool &ok, const char *msg, int &passed, int &failed) {
+    if (ok) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << msg << RESET << std::endl;
+    }
+}
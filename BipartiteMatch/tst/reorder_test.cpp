@@ -0,0 +1,118 @@
+/**
+ * reorder_test.cpp
+ * Test suite for vertex renumbering before maximum matching.
+ * Every order must give a maximum matching of the original
+ * graph in the original numbering.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "index.h"
+#include "maxmatch.h"
+#include "reorder.h"
+
+#define RESET "\033[0m"
+#define BOLDRED "\033[1m\033[31m"
+
+void test(const char *, const int *, const int &, const int &);
+void test_order(const int *, const int &, const int &, const Reorder::Order &, const int &, int &, int &);
+void check(const bool &, const char *, int &, int &);
+
+int main() {
+    /**
+     * CLRS, p. 733
+     */
+    int graph1[] = {
+        1, 0, 0, 0,
+        1, 0, 1, 0,
+        0, 1, 1, 1,
+        0, 0, 1, 0,
+        0, 0, 1, 0
+    };
+    test("Test case 1", graph1, 5, 4);
+
+    /**
+     * Sedgewick, Algorithms in C, vol. 2, p. 420
+     */
+    int graph2[] = {
+        1, 1, 1, 0, 0, 0,
+        1, 1, 0, 0, 0, 1,
+        0, 0, 1, 1, 1, 0,
+        1, 1, 0, 0, 0, 0,
+        0, 0, 0, 1, 1, 1,
+        0, 0, 1, 0, 1, 1
+    };
+    test("Test case 2", graph2, 6, 6);
+
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<int> dist(0, 59);
+    std::vector<int> graph3(50 * 60, 0);
+    for (int i = 0; i < 50; ++i) {
+        for (int k = 0; k < 2; ++k) {
+            graph3[i * 60 + dist(gen)] = 1;
+        }
+    }
+    test("Random sparse 50 x 60", graph3.data(), 50, 60);
+
+    return 0;
+}
+
+void test(const char *msg, const int *graph, const int &rows, const int &cols) {
+    std::cout << msg << std::endl;
+    int passed = 0,
+        failed = 0;
+    MaxMatch mm(graph, rows, cols);
+
+    mm.init();
+    test_order(graph, rows, cols, Reorder::ORDER_NONE, mm.matches(), passed, failed);
+    test_order(graph, rows, cols, Reorder::ORDER_DEGREE, mm.matches(), passed, failed);
+    test_order(graph, rows, cols, Reorder::ORDER_RCM, mm.matches(), passed, failed);
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << (failed > 0 ? BOLDRED : RESET) << failed << " tests failed" << RESET << std::endl << std::endl;
+}
+
+void test_order(const int *graph, const int &rows, const int &cols, const Reorder::Order &order, 
+        const int &expected, int &passed, int &failed) {
+    std::cout << "Test order " << order << std::endl;
+    Reorder reorder(graph, rows, cols, order);
+    std::vector<bool> seenX(rows, false), seenY(cols, false);
+    Index index(cols);
+    bool permutation = true,
+        consistent = true;
+    int i;
+
+    for (i = 0; i < rows; ++i) {
+        permutation = permutation && !seenX[reorder.new_X(i)];
+        seenX[reorder.new_X(i)] = true;
+    }
+    for (i = 0; i < cols; ++i) {
+        permutation = permutation && !seenY[reorder.new_Y(i)];
+        seenY[reorder.new_Y(i)] = true;
+    }
+    check(permutation, "Renumbering is not a permutation!", passed, failed);
+    reorder.init();
+    check(reorder.matches() == expected, "Incorrect number of matches!", passed, failed);
+    for (i = 0; i < rows; ++i) {
+        if (reorder.match_X(i) < 0) continue;
+        consistent = consistent && reorder.match_Y(reorder.match_X(i)) == i && 
+            graph[index.index(i, reorder.match_X(i))] != 0;
+    }
+    check(consistent, "Matches not edges of the original graph!", passed, failed);
+}
+
+void check(const bool &ok, const char *msg, int &passed, int &failed) {
+    if (ok) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << msg << RESET << std::endl;
+    }
+}
@@ -0,0 +1,177 @@
+/**
+ * resultcache_test.cpp
+ * Test suite for the certificate-checked result cache.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <iostream>
+#include <vector>
+
+#include "hungarian.h"
+#include "resultcache.h"
+
+#define RESET "\033[0m"
+#define BOLDRED "\033[1m\033[31m"
+
+void test_verify(const int *, const int &, int &, int &);
+void test_hits(const int *, const int &, const int &, int &, int &);
+void test_eviction(const int *, const int *, const int &, int &, int &);
+void test_warm_start(const int *, const int &, int &, int &);
+void test_warm_start_size(const int *, const int &, int &, int &);
+void check(const bool &, const char *, int &, int &);
+
+int main() {
+    int weights3[] = {
+        8, 15, 54, 32,
+        50, 19, 9, 98,
+        50, 79, 80, 30,
+        76, 86, 85, 48
+    };
+    int weights4[] = {
+        76, 86, 85, 48,
+        8, 15, 54, 32,
+        50, 19, 9, 98,
+        50, 79, 80, 30
+    };
+    int len = 4,
+        passed = 0,
+        failed = 0;
+
+    std::cout << "Test cache" << std::endl;
+    test_verify(weights3, len, passed, failed);
+    test_hits(weights3, len, 307, passed, failed);
+    test_eviction(weights3, weights4, len, passed, failed);
+    test_warm_start(weights3, len, passed, failed);
+    test_warm_start_size(weights3, len, passed, failed);
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << (failed > 0 ? BOLDRED : RESET) << failed << " tests failed" << RESET << std::endl << std::endl;
+    return 0;
+}
+
+void test_verify(const int *weights, const int &len, int &passed, int &failed) {
+    std::cout << "Test verify()" << std::endl;
+    Hungarian hung(weights, len);
+    std::vector<int> matchX(len), labelsX(len), labelsY(len);
+
+    hung.init();
+    for (int i = 0; i < len; ++i) {
+        matchX[i] = hung.matchX(i);
+        labelsX[i] = hung.labelX(i);
+        labelsY[i] = hung.labelY(i);
+    }
+    check(ResultCache::verify(weights, len, matchX.data(), labelsX.data(), labelsY.data()), 
+            "Optimal result not verified!", passed, failed);
+    // infeasible labels
+    --labelsX[0];
+    --labelsY[matchX[0]];
+    check(!ResultCache::verify(weights, len, matchX.data(), labelsX.data(), labelsY.data()), 
+            "Infeasible labels verified!", passed, failed);
+    ++labelsX[0];
+    ++labelsY[matchX[0]];
+    // matched edge not tight
+    ++labelsX[0];
+    check(!ResultCache::verify(weights, len, matchX.data(), labelsX.data(), labelsY.data()), 
+            "Loose matched edge verified!", passed, failed);
+    --labelsX[0];
+    // not a matching
+    matchX[1] = matchX[0];
+    check(!ResultCache::verify(weights, len, matchX.data(), labelsX.data(), labelsY.data()), 
+            "Non-matching verified!", passed, failed);
+}
+
+void test_hits(const int *weights, const int &len, const int &expected, int &passed, int &failed) {
+    std::cout << "Test hits and misses" << std::endl;
+    ResultCache cache(1 << 20);
+    std::vector<int> first(len), second(len);
+    int total1 = cache.solve(weights, len, first.data()),
+        total2 = cache.solve(weights, len, second.data());
+
+    check(total1 == expected && total2 == expected, "Incorrect total!", passed, failed);
+    check(first == second, "Cached matching differs!", passed, failed);
+    check(cache.hits() == 1 && cache.misses() == 1 && cache.size() == 1, 
+            "Incorrect hit and miss counts!", passed, failed);
+    check(cache.bytes() > 0 && cache.rejected() == 0, "Incorrect cache stats!", passed, failed);
+}
+
+void test_eviction(const int *weights1, const int *weights2, const int &len, int &passed, int &failed) {
+    std::cout << "Test eviction" << std::endl;
+    ResultCache probe(1 << 20);
+    std::vector<int> matchX(len);
+
+    probe.solve(weights1, len, matchX.data());
+    // room for exactly one result
+    ResultCache cache(probe.bytes());
+    cache.solve(weights1, len, matchX.data());
+    cache.solve(weights2, len, matchX.data());
+    check(cache.evictions() == 1 && cache.size() == 1 && cache.bytes() <= probe.bytes(), 
+            "Memory bound not enforced!", passed, failed);
+    cache.solve(weights2, len, matchX.data());
+    cache.solve(weights1, len, matchX.data());
+    check(cache.hits() == 1 && cache.misses() == 3, "Incorrect entry evicted!", passed, failed);
+}
+
+void test_warm_start(const int *weights, const int &len, int &passed, int &failed) {
+    std::cout << "Test near-exact repeat" << std::endl;
+    ResultCache cache(1 << 20);
+    std::vector<int> near(weights, weights + len * len), matchX(len);
+    bool optimal = true;
+
+    cache.solve(weights, len, matchX.data());
+    // change each entry in turn, up and down
+    for (int k = 0; k < len * len; ++k) {
+        for (int delta = -40; delta <= 40; delta += 80) {
+            near[k] += delta;
+            Hungarian hung(near.data(), len);
+            hung.init();
+            optimal = optimal && cache.solve(near.data(), len, matchX.data()) == hung.get_match_total();
+            near[k] -= delta;
+        }
+    }
+    check(optimal, "Warm-started solve not optimal!", passed, failed);
+    check(cache.warm_starts() == cache.misses() - 1 && cache.hits() == 0, 
+            "Near-exact repeats not warm started!", passed, failed);
+}
+
+/**
+ * warm starts come only from a cached result of the same size,
+ * and not from one that has been evicted
+ */
+void test_warm_start_size(const int *weights, const int &len, int &passed, int &failed) {
+    std::cout << "Test warm start by size" << std::endl;
+    int small[] = {
+        1, 6, 0,
+        0, 8, 6,
+        4, 0, 1
+    };
+    ResultCache probe(1 << 20);
+    std::vector<int> near(weights, weights + len * len), matchX(len);
+
+    probe.solve(weights, len, matchX.data());
+    // room for exactly one result of this size
+    ResultCache cache(probe.bytes());
+    cache.solve(weights, len, matchX.data());
+    cache.solve(small, 3, matchX.data());
+    check(cache.warm_starts() == 0 && cache.evictions() == 1, "Warm started from another size!", 
+            passed, failed);
+    ++near[0];
+    check(cache.solve(near.data(), len, matchX.data()) == probe.solve(near.data(), len, matchX.data()), 
+            "Incorrect total after eviction!", passed, failed);
+    check(cache.warm_starts() == 0, "Warm started from an evicted result!", passed, failed);
+    ++near[1];
+    cache.solve(near.data(), len, matchX.data());
+    check(cache.warm_starts() == 1, "Near-exact repeat not warm started!", passed, failed);
+}
+
+void check(const bool &ok, const char *msg, int &passed, int &failed) {
+    if (ok) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << msg << RESET << std::endl;
+    }
+}
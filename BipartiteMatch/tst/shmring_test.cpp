@@ -0,0 +1,247 @@
+/**
+ * shmring_test.cpp
+ * Test suite for the shared memory request ring.
+ * Client threads submit known Hungarian problems to a
+ * server thread in the same process through a ring with
+ * fewer slots than requests, so slots are reused.
+ * Clients must also be able to give up on a stopped or
+ * unresponsive server without wedging the ring.
+ *
+ * Copyright (c) 2026 Marshall Farrier
+ * license http://opensource.org/licenses/gpl-license.php GNU Public License
+ *
+ * Author Marshall Farrier
+ * Since 2026-10-18
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "hungarian.h"
+#include "shmring.h"
+
+#define RESET "\033[0m"
+#define BOLDRED "\033[1m\033[31m"
+
+void test_attach(const char *, int &, int &);
+void test_requests(ShmRing &, int &, int &);
+void test_give_up(const char *, int &, int &);
+void server(ShmRing &);
+void client(const char *, const int *, const int &, const int &, const int &, std::atomic<int> &);
+
+int weights1[] = {
+    1, 6, 0,
+    0, 8, 6,
+    4, 0, 1
+};
+int weights3[] = {
+    8, 15, 54, 32,
+    50, 19, 9, 98,
+    50, 79, 80, 30,
+    76, 86, 85, 48
+};
+
+int main() {
+    std::string name = "/cpp-graph-shmring-test-" + std::to_string(getpid());
+    int passed = 0,
+        failed = 0;
+    ShmRing ring(name.c_str(), 3, 4);
+
+    std::cout << "Test ring" << std::endl;
+    test_attach(name.c_str(), passed, failed);
+    test_requests(ring, passed, failed);
+    test_give_up((name + "-give-up").c_str(), passed, failed);
+    std::cout << passed << " tests passed" << std::endl;
+    std::cout << (failed > 0 ? BOLDRED : RESET) << failed << " tests failed" << RESET << std::endl << std::endl;
+    return 0;
+}
+
+void test_attach(const char *name, int &passed, int &failed) {
+    std::cout << "Test attach" << std::endl;
+    ShmRing ring(name);
+
+    if (ring.slots() == 3 && ring.max_len() == 4) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << "Attached ring has wrong layout!" << std::endl;
+        std::cerr << "expected: 3 slots of 4, actual: " << ring.slots() << " slots of " 
+            << ring.max_len() << RESET << std::endl;
+    }
+    try {
+        ShmRing missing("/cpp-graph-shmring-test-missing");
+        ++failed;
+        std::cerr << BOLDRED << "Attached to a ring that doesn't exist!" << RESET << std::endl;
+    } catch (const std::runtime_error &) {
+        ++passed;
+    }
+    try {
+        ShmRing duplicate(name, 3, 4);
+        ++failed;
+        std::cerr << BOLDRED << "Created a second ring over a live one!" << RESET << std::endl;
+    } catch (const std::runtime_error &) {
+        ++passed;
+    }
+    // a segment of the wrong size must not be trusted
+    std::string bad = std::string(name) + "-bad";
+    ShmRing created(bad.c_str(), 3, 4);
+    struct stat st;
+    int fd = shm_open(bad.c_str(), O_RDWR, 0600);
+
+    if (fd >= 0 && fstat(fd, &st) == 0 && ftruncate(fd, st.st_size + 4096) == 0) {
+        try {
+            ShmRing attached(bad.c_str());
+            ++failed;
+            std::cerr << BOLDRED << "Attached to a ring of the wrong size!" << RESET << std::endl;
+        } catch (const std::runtime_error &) {
+            ++passed;
+        }
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << "Cannot resize test ring!" << RESET << std::endl;
+    }
+    if (fd >= 0) close(fd);
+}
+
+void test_requests(ShmRing &ring, int &passed, int &failed) {
+    std::cout << "Test requests from concurrent clients" << std::endl;
+    const int clients = 4,
+        requests = 50;
+    std::atomic<int> wrong(0);
+    std::vector<std::thread> threads;
+    std::thread server_thread(server, std::ref(ring));
+    std::string name = "/cpp-graph-shmring-test-" + std::to_string(getpid());
+
+    for (int i = 0; i < clients; ++i) {
+        if (i % 2 == 0) {
+            threads.emplace_back(client, name.c_str(), weights1, 3, 16, requests, std::ref(wrong));
+        } else {
+            threads.emplace_back(client, name.c_str(), weights3, 4, 307, requests, std::ref(wrong));
+        }
+    }
+    for (std::thread &t : threads) {
+        t.join();
+    }
+    // shut the server down through the ring
+    unsigned long long ticket;
+    if (ring.acquire(ticket)) {
+        ring.slot(ticket).kind = ShmRing::KIND_SHUTDOWN;
+        ring.submit(ticket);
+        if (ring.wait(ticket)) ring.release(ticket);
+    }
+    server_thread.join();
+
+    if (wrong.load() == 0) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << wrong.load() << " incorrect results!" << RESET << std::endl;
+    }
+    if (ring.stopped()) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << "Server not stopped!" << RESET << std::endl;
+    }
+}
+
+/**
+ * no server thread: requests are taken and completed by hand
+ */
+void test_give_up(const char *name, int &passed, int &failed) {
+    std::cout << "Test deadlines and stop" << std::endl;
+    ShmRing ring(name, 3, 2);
+    unsigned long long tickets[3], ticket, taken;
+    auto soon = [] { return std::chrono::steady_clock::now() + std::chrono::milliseconds(10); };
+    int i;
+
+    for (i = 0; i < 3; ++i) {
+        ring.acquire(tickets[i]);
+        ring.slot(tickets[i]).kind = ShmRing::KIND_HUNGARIAN;
+        ring.submit(tickets[i]);
+    }
+    if (!ring.acquire(ticket, soon()) && !ring.wait(tickets[0], soon())) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << "Full ring or missing result not timed out!" << RESET << std::endl;
+    }
+    // completing the abandoned request frees its slot
+    if (ring.take(taken) && taken == tickets[0]) ring.complete(taken);
+    if (ring.acquire(ticket, soon()) && ticket == tickets[0] + 3) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << "Abandoned slot not released by the server!" << RESET << std::endl;
+    }
+    ring.request_stop();
+    if (!ring.wait(tickets[1]) && !ring.acquire(ticket)) {
+        ++passed;
+    } else {
+        ++failed;
+        std::cerr << BOLDRED << "Client kept waiting on a stopped ring!" << RESET << std::endl;
+    }
+}
+
+void server(ShmRing &ring) {
+    unsigned long long ticket;
+
+    while (!ring.stopped()) {
+        if (!ring.take(ticket)) {
+            std::this_thread::yield();
+            continue;
+        }
+        ShmRing::Slot &slot = ring.slot(ticket);
+        if (slot.kind == ShmRing::KIND_SHUTDOWN) {
+            ring.request_stop();
+        } else {
+            Hungarian hung(ring.matrix(ticket), slot.rows);
+            hung.init();
+            for (int i = 0; i < slot.rows; ++i) {
+                ring.match(ticket)[i] = hung.matchX(i);
+            }
+            slot.total = hung.get_match_total();
+        }
+        ring.complete(ticket);
+    }
+}
+
+/**
+ * each client attaches its own mapping, as a separate process would
+ */
+void client(const char *name, const int *weights, const int &len, const int &expected, 
+        const int &requests, std::atomic<int> &wrong) {
+    ShmRing ring(name);
+
+    for (int r = 0; r < requests; ++r) {
+        unsigned long long ticket;
+        if (!ring.acquire(ticket)) {
+            ++wrong;
+            return;
+        }
+        ShmRing::Slot &slot = ring.slot(ticket);
+
+        slot.kind = ShmRing::KIND_HUNGARIAN;
+        slot.rows = len;
+        slot.cols = len;
+        std::memcpy(ring.matrix(ticket), weights, len * len * sizeof(int));
+        ring.submit(ticket);
+        if (!ring.wait(ticket)) {
+            ++wrong;
+            return;
+        }
+        if (slot.total != expected) ++wrong;
+        ring.release(ticket);
+    }
+}